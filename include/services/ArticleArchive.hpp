@@ -0,0 +1,91 @@
+#pragma once
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "services/RSSService.hpp"
+
+namespace InfoDash {
+
+// On-disk history of every article seen, so refreshes add to what is shown
+// instead of replacing it and the panel has something to show offline.
+//
+// Articles are appended to a log (Config::getCachePath()/articles/
+// articles.log) that is read through mmap. An article is identified by its
+// GUID, or by its link when the feed gives none; a refresh appends only
+// articles that are new or whose content changed, superseding the older
+// record. The in-memory index (article -> record, per-feed lists ordered by
+// date) is saved to articles.idx by flush(); on startup it
+// is loaded and only the log written after it is replayed. Each feed keeps
+// its newest kMaxPerFeed articles; when superseded records outweigh live
+// ones the log is rewritten.
+//
+// The archive is queried by feed only. Read and saved state live in Config
+// keyed by link, and the views filter on them through the loaded
+// ArticleStore's link lookup rather than through the archive.
+class ArticleArchive {
+public:
+    static constexpr size_t kMaxPerFeed = 200;
+
+    static ArticleArchive& getInstance();
+
+    // Record a fresh fetch of `feedUrl` and return the feed's archived
+    // articles, newest first. An empty `items` (failed fetch) just returns
+    // the archive.
+    std::vector<RSSItem> merge(const std::string& feedUrl, const std::vector<RSSItem>& items);
+
+    // Archived articles of one feed, newest first.
+    std::vector<RSSItem> feedItems(const std::string& feedUrl, size_t limit = kMaxPerFeed);
+
+    // Persist the index and compact the log if worthwhile. Cheap when
+    // nothing changed since the last call.
+    void flush();
+
+private:
+    ArticleArchive();
+    ~ArticleArchive();
+    ArticleArchive(const ArticleArchive&) = delete;
+    ArticleArchive& operator=(const ArticleArchive&) = delete;
+
+    struct Entry {
+        uint64_t offset;       // record position in the log
+        uint64_t contentHash;  // of the fields a refresh may change
+        int64_t pubTime;
+        uint32_t feed;
+        uint32_t size;         // record length, header included
+    };
+
+    struct Feed {
+        std::string url;
+        std::vector<uint64_t> keys;  // newest first once sorted
+        bool sorted = true;
+    };
+
+    void open();
+    bool loadIndex();
+    void saveIndex();
+    void replay(uint64_t from);
+    bool remap();
+    void compact();
+    uint32_t feedId(const std::string& url);
+    void sortFeed(Feed& feed);
+    void trimFeed(Feed& feed);
+    bool readRecord(const Entry& entry, RSSItem& item) const;
+    void indexRecord(uint64_t key, const Entry& entry);
+
+    std::mutex mutex_;
+    std::string dir_;
+    int fd_ = -1;
+    const char* map_ = nullptr;
+    uint64_t mapSize_ = 0;
+    uint64_t logSize_ = 0;
+    uint64_t liveBytes_ = 0;
+    bool dirty_ = false;
+    std::unordered_map<uint64_t, Entry> entries_;   // article key -> latest record
+    std::vector<Feed> feeds_;
+    std::unordered_map<std::string, uint32_t> feedIds_;
+};
+
+}
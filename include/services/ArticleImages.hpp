@@ -0,0 +1,57 @@
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace InfoDash {
+
+// Finds a lead image for articles whose feed entry has none, from the
+// og:image / twitter:image / image_src tags of the article page. Only the
+// page head is downloaded: the transfer is aborted once </head> (or <body>)
+// arrives. A few pages are fetched at a time, and results are kept per
+// article URL in memory and in DiskCache so refreshes and restarts do not
+// fetch the same page again. "No image" is only trusted for
+// kNoImageDays, since pages gain images after they are first published.
+class ArticleImages {
+public:
+    using Callback = std::function<void(const std::string& link, const std::string& imageUrl)>;
+
+    static ArticleImages& getInstance();
+
+    // Cached result for `link`; false if the page was never resolved. May
+    // read the disk, so keep it off the main thread.
+    bool lookup(const std::string& link, std::string& imageUrl);
+
+    // Resolve every link in the background; cached results are looked up
+    // there too. `onImage` runs on an engine worker, once per link for
+    // which an image was found.
+    void resolve(const std::vector<std::string>& links, Callback onImage);
+
+private:
+    ArticleImages() = default;
+    ArticleImages(const ArticleImages&) = delete;
+    ArticleImages& operator=(const ArticleImages&) = delete;
+
+    void startNext();
+    void resolveNow(const std::vector<std::string>& links, const Callback& onImage);
+    void remember(const std::string& link, const std::string& imageUrl);
+    void finish(const std::string& link, const std::string& imageUrl, bool cacheable);
+
+    static constexpr size_t kMaxConcurrent = 6;
+    static constexpr size_t kMaxRemembered = 20000;
+    static constexpr int64_t kNoImageDays = 7;
+
+    std::mutex mutex_;
+    // In-memory front of the DiskCache entries; emptied when it reaches
+    // kMaxRemembered, the disk still has everything.
+    std::unordered_map<std::string, std::string> resolved_;
+    std::unordered_map<std::string, std::vector<Callback>> waiting_;  // queued or in flight
+    std::deque<std::string> queue_;
+    size_t active_ = 0;
+};
+
+}
@@ -0,0 +1,114 @@
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "services/RSSService.hpp"
+
+namespace InfoDash {
+
+// Compact, append-only storage for the articles of one refresh. The text
+// fields of every article share a single arena, sources and authors are
+// interned to small IDs, and callers (widgets included) refer to an article
+// by its index rather than holding a copy.
+//
+// Text accessors return views into the arena; each is NUL-terminated, so
+// data() can go straight to C APIs. Views stay valid until the next add()
+// or setImageUrl(), so take them on the thread that owns the store.
+class ArticleStore {
+public:
+    using Index = uint32_t;
+
+    Index add(const RSSItem& item);
+    // Same, with `source` recorded in place of item.source.
+    Index add(const RSSItem& item, std::string_view source);
+    void reserve(size_t articles, size_t textBytes);
+    void clear();
+
+    size_t size() const { return articles_.size(); }
+    bool empty() const { return articles_.empty(); }
+
+    std::string_view title(Index i) const { return view(articles_[i].title); }
+    std::string_view link(Index i) const { return view(articles_[i].link); }
+    std::string_view description(Index i) const { return view(articles_[i].description); }
+    std::string_view pubDate(Index i) const { return view(articles_[i].pubDate); }
+    std::string_view imageUrl(Index i) const { return view(articles_[i].imageUrl); }
+    int64_t pubTime(Index i) const { return articles_[i].pubTime; }
+
+    const std::string& source(Index i) const { return sources_.name(articles_[i].source); }
+    const std::string& author(Index i) const { return authors_.name(articles_[i].author); }
+    uint32_t sourceId(Index i) const { return articles_[i].source; }
+    // ID of `source`, or kNoId if no article has it.
+    uint32_t findSource(std::string_view source) const { return sources_.find(source); }
+    // The article last added with `link`, or kNoId. Saved and read state
+    // are kept by link, so the views resolve them through this.
+    Index findLink(std::string_view link) const;
+    // Source IDs run from 0 to sourceCount() - 1.
+    size_t sourceCount() const { return sources_.size(); }
+    static constexpr uint32_t kNoId = UINT32_MAX;
+
+    // The old image span is left in the arena; this is for the rare late
+    // image, not for bulk rewrites.
+    void setImageUrl(Index i, std::string_view url);
+
+    // A standalone copy, for code that still wants an RSSItem.
+    RSSItem item(Index i) const;
+
+    // Heap bytes held: arena, article records and intern tables.
+    size_t memoryUsage() const;
+
+private:
+    struct Span {
+        uint32_t offset = 0;
+        uint32_t length = 0;
+    };
+
+    struct Article {
+        Span title;
+        Span link;
+        Span description;
+        Span pubDate;
+        Span imageUrl;
+        uint32_t source;
+        uint32_t author;
+        int64_t pubTime;
+    };
+
+    // Names are stored once; a deque keeps them in place so the lookup map
+    // can key on views of them. Copying would leave the views dangling, so
+    // an interner (and with it the store) can only be moved.
+    class Interner {
+    public:
+        Interner() = default;
+        Interner(const Interner&) = delete;
+        Interner& operator=(const Interner&) = delete;
+        Interner(Interner&&) = default;
+        Interner& operator=(Interner&&) = default;
+
+        uint32_t intern(std::string_view name);
+        uint32_t find(std::string_view name) const;
+        const std::string& name(uint32_t id) const { return names_[id]; }
+        size_t size() const { return names_.size(); }
+        size_t memoryUsage() const;
+        void clear();
+
+    private:
+        std::deque<std::string> names_;
+        std::unordered_map<std::string_view, uint32_t> ids_;
+    };
+
+    Span append(std::string_view text);
+    std::string_view view(Span s) const { return std::string_view(arena_.data() + s.offset, s.length); }
+
+    std::string arena_;
+    std::vector<Article> articles_;
+    // Link hash -> article. The arena moves as it grows, so the map cannot
+    // key on views of the links themselves; findLink() checks the match.
+    std::unordered_map<size_t, Index> links_;
+    Interner sources_;
+    Interner authors_;
+};
+
+}
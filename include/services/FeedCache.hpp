@@ -0,0 +1,47 @@
+#pragma once
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "services/RSSService.hpp"
+
+namespace InfoDash {
+
+// Conditional-GET cache for feed refreshes, keyed by feed URL. Holds the
+// validators from the last 200 response together with the items parsed from
+// it, so a 304 can be answered without re-parsing. Entries are written
+// through to DiskCache and reloaded on demand, which also gives the panel
+// something to show at startup before any network round trip.
+class FeedCache {
+public:
+    struct Entry {
+        std::string etag;
+        std::string lastModified;
+        // Feed autodiscovered from `url` when that is an HTML page; empty
+        // when `url` is the feed itself. The validators belong to this URL.
+        std::string feedUrl;
+        std::shared_ptr<const std::vector<RSSItem>> items;
+    };
+
+    static FeedCache& getInstance();
+
+    bool lookup(const std::string& url, Entry& entry) const;
+    void store(const std::string& url, Entry entry);
+    void erase(const std::string& url);
+
+    // If-None-Match / If-Modified-Since for `entry`. They are only
+    // meaningful for the URL it was served from (feedUrl, or the key).
+    static std::map<std::string, std::string> conditionalHeaders(const Entry& entry);
+
+private:
+    FeedCache() = default;
+    FeedCache(const FeedCache&) = delete;
+    FeedCache& operator=(const FeedCache&) = delete;
+
+    mutable std::mutex mutex_;
+    mutable std::unordered_map<std::string, Entry> entries_;
+};
+
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <vector>
+#include <libxml/parser.h>
+#include "services/RSSService.hpp"
+
+namespace InfoDash {
+
+// One-pass RSS/Atom parser on libxml2's SAX2 push interface. Items are built
+// straight into RSSItem as elements close; no DOM tree or per-item maps are
+// kept, so peak memory stays close to one item regardless of feed size.
+// Input can be pushed in chunks as it downloads.
+class FeedParser {
+public:
+    FeedParser();
+    ~FeedParser();
+    FeedParser(const FeedParser&) = delete;
+    FeedParser& operator=(const FeedParser&) = delete;
+
+    // Push the next chunk; false once the document is known to be malformed.
+    bool feed(const char* data, size_t size);
+    // End of input; false if the document was not well-formed.
+    bool finish();
+    // Items completed since the previous call, for showing partial results.
+    std::vector<RSSItem> takeNewItems();
+    // The full item list. Call after finish().
+    std::vector<RSSItem> takeItems();
+    // Whether the root element is that of an RSS, RDF or Atom feed, so an
+    // empty list means a feed with no items rather than some other page.
+    bool isFeed() const;
+
+    // Returns false if the document is not well-formed XML; callers then
+    // fall back to the recovering DOM parser (HtmlParser::parseRSSItems).
+    static bool parse(const std::string& xml, std::vector<RSSItem>& items);
+
+    struct State;
+
+private:
+    std::unique_ptr<State> state_;
+    xmlParserCtxtPtr ctxt_;
+};
+
+}
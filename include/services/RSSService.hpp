@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <functional>
@@ -10,16 +11,40 @@ struct RSSItem {
     std::string link;
     std::string description;
     std::string pubDate;
+    int64_t pubTime = 0;  // pubDate in Unix seconds; 0 if it did not parse
     std::string source;
     std::string imageUrl;
     std::string author;
+    std::string guid;     // <guid> (RSS) or <id> (Atom); may be empty
 };
 
 class RSSService {
 public:
+    // `ok` is false if the feed could not be fetched or read; true with no
+    // items for a feed that is simply empty.
+    using FeedCallback = std::function<void(std::vector<RSSItem> items, bool ok)>;
+
     RSSService();
-    void fetchFeed(const std::string& url, std::function<void(std::vector<RSSItem>)> callback);
+    // `onPartial`, if set, receives items as they are parsed during the
+    // download; `callback` still gets the complete, final list.
+    void fetchFeed(const std::string& url, FeedCallback callback,
+                   std::function<void(std::vector<RSSItem>)> onPartial = nullptr);
     void fetchAllFeeds(std::function<void(std::vector<RSSItem>)> callback);
+
+    // Newest-first merge of per-feed item lists on pubTime. Lists out of
+    // order are sorted first; equal times keep list order. If `origin` is
+    // given it receives, per merged item, the index of its list.
+    static std::vector<RSSItem> mergeByDate(std::vector<std::vector<RSSItem>> lists,
+                                            std::vector<uint32_t>* origin = nullptr);
+
+    // Items from the last successful fetch of `url`; no network.
+    void loadCachedFeed(const std::string& url, std::function<void(std::vector<RSSItem>)> callback);
+
+    // Items are delivered without waiting for article pages, so entries
+    // that carry no image of their own may get one later. Pass their links;
+    // `onImage` runs on a worker thread for each page that names an image.
+    void resolveImages(const std::vector<std::string>& links,
+                       std::function<void(std::string link, std::string imageUrl)> onImage);
 };
 
 }
@@ -0,0 +1,79 @@
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace InfoDash {
+
+// In-memory inverted index for article search. Documents are ArticleStore
+// indices; each is added once, with its title, description (HTML allowed;
+// tags are skipped) and author, and can be searched right away.
+//
+// Words are runs of ASCII letters and digits or non-ASCII bytes, folded to
+// ASCII lower case. Every word of a query must match, as a whole word or as
+// a prefix of one. Results are ranked by where the words occur (title over
+// author over description), how rare they are, and whole-word over prefix
+// matches; ties keep document order.
+//
+// Like ArticleStore, an index belongs to one thread at a time: search()
+// sorts words added since the last call into the word list first, and
+// keeps its scratch arrays between calls.
+class SearchIndex {
+public:
+    using DocId = uint32_t;
+
+    void add(DocId doc, std::string_view title, std::string_view description, std::string_view author);
+    void clear();
+
+    // Do now the word-list sorting the next search() would do. Call after a
+    // batch of add() on the thread that built the index.
+    void prepare() const;
+
+    size_t documentCount() const { return documents_; }
+    size_t termCount() const { return terms_.size(); }
+
+    // Matching documents, best first, at most `limit` of them.
+    std::vector<DocId> search(std::string_view query, size_t limit = SIZE_MAX) const;
+
+    // Heap bytes held by terms and postings.
+    size_t memoryUsage() const;
+
+private:
+    struct Posting {
+        DocId doc;
+        uint16_t weight;  // field weights summed over occurrences, saturating
+    };
+
+    uint32_t termId(std::string_view term);
+    void addField(DocId doc, std::string_view text, uint16_t weight, bool html);
+    std::vector<DocId> rankedHits(size_t limit) const;  // candidates_ by ranks_
+
+    std::deque<std::string> terms_;
+    std::unordered_map<std::string_view, uint32_t> termIds_;
+    std::vector<std::vector<Posting>> postings_;  // by term id
+    size_t documents_ = 0;
+    DocId docLimit_ = 0;                          // highest doc id + 1
+    bool ordered_ = true;                         // docs were added in increasing order
+
+    mutable std::vector<uint32_t> sorted_;        // term ids in word order
+
+    // search() scratch, kept between calls; matched_ and score_ are by doc
+    // and all zero outside a search.
+    mutable std::vector<uint8_t> matched_;
+    mutable std::vector<float> score_;
+    mutable std::vector<DocId> candidates_;
+    mutable std::vector<uint16_t> ranks_;
+    mutable std::vector<DocId> docsOut_;
+    mutable std::vector<uint16_t> ranksOut_;
+    struct RankCount {
+        uint16_t rank;
+        size_t count;
+    };
+    mutable std::vector<uint16_t> rankSlot_;      // by rank: 1 + index into distinct_, or 0
+    mutable std::vector<RankCount> distinct_;
+};
+
+}
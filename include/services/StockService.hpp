@@ -19,6 +19,9 @@ public:
     StockService();
     void fetchStock(const std::string& symbol, std::function<void(StockData)> callback);
     void fetchAllStocks(std::function<void(std::vector<StockData>)> callback);
+
+    // Last successful quote per symbol from the disk cache; no network.
+    void loadCachedStocks(std::function<void(std::vector<StockData>)> callback);
 };
 
 }
@@ -0,0 +1,45 @@
+#pragma once
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "services/ArticleStore.hpp"
+#include "utils/Config.hpp"
+
+namespace InfoDash {
+
+// Unread counts for the articles shown from one ArticleStore, per feed and
+// per category, plus how many of them are saved. They are kept current as marks
+// change, so the sidebar reads its badges instead of rescanning articles.
+//
+// rebuild() is the only pass over the articles and runs when a new store is
+// swapped in. assignCategories() is O(feeds) and must follow any change to
+// which feeds are enabled or where they are filed. Main thread only, like
+// the marks themselves.
+class UnreadCounts {
+public:
+    // Counts `articles`, the store's articles on display.
+    void rebuild(const ArticleStore& store, const std::vector<ArticleStore::Index>& articles, const Config& config);
+    void assignCategories(const ArticleStore& store, const std::vector<FeedInfo>& feeds);
+    void clear();
+
+    // Record a mark change already applied to Config.
+    void setRead(const ArticleStore& store, ArticleStore::Index i, bool read);
+    void setSaved(bool saved) { saved_ += saved ? 1 : -1; }
+
+    int total() const { return total_; }
+    int saved() const { return saved_; }
+    int source(uint32_t sourceId) const;
+    int category(const std::string& categoryId) const;
+    // Category the source's feed counts towards, or nullptr if the feed is
+    // disabled or no longer configured.
+    const std::string* categoryOf(uint32_t sourceId) const;
+
+private:
+    std::vector<int> bySource_;                         // by ArticleStore source ID
+    std::vector<const std::string*> sourceCategory_;    // keys of byCategory_
+    std::unordered_map<std::string, int> byCategory_;
+    int total_ = 0;
+    int saved_ = 0;
+};
+
+}
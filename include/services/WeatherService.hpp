@@ -40,6 +40,9 @@ public:
     void fetchWeather(const std::string& location, std::function<void(WeatherData)> callback);
     void fetchAllLocations(std::function<void(std::vector<WeatherData>)> callback);
     
+    // Last successful result per location from the disk cache; no network.
+    void loadCachedLocations(std::function<void(std::vector<WeatherData>)> callback);
+    
     // Map condition code to icon name
     static std::string getWeatherIcon(const std::string& conditionCode);
 };
@@ -0,0 +1,25 @@
+#pragma once
+#include <gtk/gtk.h>
+#include <vector>
+#include "services/ArticleStore.hpp"
+
+namespace InfoDash {
+
+// A GListModel of article-store indices for GtkListView/GtkGridView. The
+// model holds only the index vector; the item for a position is a tiny
+// GObject made when the view asks for it, so only rows on screen (plus the
+// view's small overscan) ever have an item or a widget.
+class ArticleListModel {
+public:
+    // New empty model; the caller owns the reference.
+    static GListModel* create();
+
+    // Replace the contents and tell the views every position changed, so
+    // recycled rows are rebound even where the index is the same.
+    static void setIndices(GListModel* model, std::vector<ArticleStore::Index> indices);
+
+    // Article-store index held by an item taken from the model.
+    static ArticleStore::Index indexOf(gpointer item);
+};
+
+}
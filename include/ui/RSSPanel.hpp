@@ -4,7 +4,11 @@
 #include <vector>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include "services/ArticleStore.hpp"
 #include "services/RSSService.hpp"
+#include "services/SearchIndex.hpp"
+#include "services/UnreadCounts.hpp"
 #include "utils/Config.hpp"
 
 namespace InfoDash {
@@ -34,42 +38,73 @@ public:
     void updateSidebar();
     void loadFeedsForCategory(const std::string& category);
     
-    // Article actions
-    void markArticleRead(const std::string& articleUrl);
-    void toggleArticleSaved(const std::string& articleUrl);
+    // Article actions. These patch the card or row showing the article and
+    // the affected sidebar badges in place; neither view is rebuilt.
+    void setArticleRead(ArticleStore::Index index, bool read);
+    void toggleArticleSaved(ArticleStore::Index index);
     
-    // Get items for saved articles
-    const std::vector<RSSItem>& getAllItems() const { return allItems_; }
+    // Articles currently loaded
+    const ArticleStore& getArticles() const { return articles_; }
 
 private:
     void setupUI();
     void setupSidebar();
     void setupContentArea();
     void loadFeeds();
-    void addArticleCard(const RSSItem& item);
-    void addArticleListItem(const RSSItem& item);
+    enum class FeedLoad { Loading, Loaded, Failed };
+    struct LiveBatch;
+    void loadCachedFeeds();
+    void fetchLiveFeeds();
+    void onLiveProgress(const std::shared_ptr<LiveBatch>& batch);
+    void resolveArticleImages();
+    void showArticleView(bool listMode);
+    void attachArticleGestures(GtkWidget* root, GtkListItem* listItem);
+    bool isCurrentArticle(ArticleStore::Index index, const std::string& link) const;
+    void updateArticleBadges(ArticleStore::Index index);
     void selectCategory(const std::string& categoryId);
     void selectFeed(const std::string& feedName);
     void updateLayoutToggle();
     bool isRSSFeed(const std::string& content);
-    void showArticleContextMenu(GtkWidget* widget, const RSSItem& item, double x, double y);
+    void showArticleContextMenu(GtkWidget* widget, ArticleStore::Index index, double x, double y);
     
     static void onAddFeedClicked(GtkButton* button, gpointer userData);
     static void onManageFeedsClicked(GtkButton* button, gpointer userData);
     static void onCategorySelected(GtkListBox* listBox, GtkListBoxRow* row, gpointer userData);
     static void onMarkAllReadClicked(GtkButton* button, gpointer userData);
     static void onAddCategoryClicked(GtkButton* button, gpointer userData);
+    static void onSearchChanged(GtkSearchEntry* entry, gpointer userData);
+    static void onCardSetup(GtkSignalListItemFactory* factory, GtkListItem* listItem, gpointer userData);
+    static void onListRowSetup(GtkSignalListItemFactory* factory, GtkListItem* listItem, gpointer userData);
+    static void onArticleBind(GtkSignalListItemFactory* factory, GtkListItem* listItem, gpointer userData);
+    static void onArticleUnbind(GtkSignalListItemFactory* factory, GtkListItem* listItem, gpointer userData);
 
     GtkWidget* mainPaned_;
     GtkWidget* categoryList_;
-    GtkWidget* articlesContainer_;
+    GtkWidget* articlesView_;  // GtkGridView (cards) or GtkListView (list)
+    GListModel* articleModel_;  // ArticleListModel shown by articlesView_
+    bool listLayout_ = false;  // layout articlesView_ was built for
+    std::unordered_map<ArticleStore::Index, GtkWidget*> boundWidgets_;  // article -> its card or row
+    // Sidebar count labels, hidden rather than removed at zero so they can
+    // be updated in place.
+    std::map<std::string, GtkWidget*> categoryBadges_;  // by category id, "all" and "saved" included
+    std::map<std::string, GtkWidget*> feedBadges_;  // by feed name, expanded categories only
     GtkWidget* articlesScrolled_;
     GtkWidget* categoryTitle_;
     GtkWidget* layoutToggleBtn_;
     
     std::string currentCategory_;
     std::string currentFeed_;  // Empty means show all feeds in category
-    std::vector<RSSItem> allItems_;
+    // During a refresh articles_ also holds articles that were replaced, such
+    // as a feed's partial list once the whole of it is in; only those in
+    // articleOrder_ are shown.
+    ArticleStore articles_;
+    std::vector<ArticleStore::Index> articleOrder_;  // articles shown, newest first
+    SearchIndex searchIndex_;  // over articles_, built with it
+    UnreadCounts unreadCounts_;  // over articleOrder_, rebuilt with it
+    std::string searchQuery_;  // empty: no filtering
+    bool liveItemsLoaded_ = false;  // cached items must not replace these
+    std::shared_ptr<LiveBatch> liveBatch_;  // refresh in progress, if any
+    std::map<std::string, FeedLoad> feedLoad_;  // by feed name, last refresh only
 };
 
 }
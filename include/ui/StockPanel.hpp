@@ -18,6 +18,7 @@ private:
     void updateStocks(const std::vector<StockData>& data);
     static void onAddStockClicked(GtkButton* button, gpointer userData);
     static gboolean updateUICallback(gpointer userData);
+    void loadCached();
     static gboolean tickerUpdateCallback(gpointer userData);
 
     GtkWidget* widget_;
@@ -26,6 +27,7 @@ private:
     GtkWidget* symbolEntry_;
     std::unique_ptr<StockService> service_;
     std::vector<StockData> pendingData_;
+    bool liveDataShown_ = false;  // cached data must not replace live data
     guint tickerTimerId_;
 };
 
@@ -24,6 +24,7 @@ private:
     static void onRemoveLocationClicked(GtkButton* button, gpointer userData);
     static void onTempUnitToggled(GtkButton* button, gpointer userData);
     static gboolean updateUICallback(gpointer userData);
+    void loadCached();
 
     GtkWidget* widget_;
     GtkWidget* weatherBox_;
@@ -34,6 +35,7 @@ private:
     GtkWidget* loadingLabel_;
     std::unique_ptr<WeatherService> service_;
     std::vector<WeatherData> pendingData_;
+    bool liveDataShown_ = false;  // cached data must not replace live data
 };
 
 }
@@ -1,8 +1,17 @@
 #pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
+#include <functional>
 #include <map>
 #include <set>
+#include <string_view>
+#include "utils/ReadSet.hpp"
 
 namespace InfoDash {
 
@@ -48,12 +57,31 @@ struct ThemePreferences {
     ThemePreferences();
 };
 
+// The settings at one point in time. A published snapshot never changes:
+// any thread may take one from Config::snapshot() and keep it as long as
+// it likes, and every change publishes a modified copy.
+struct ConfigSnapshot {
+    std::vector<FeedInfo> feeds;
+    std::vector<Category> categories;  // in display order
+    std::vector<std::string> weatherLocations;
+    std::vector<std::string> stockSymbols;
+    LayoutMode layoutMode = LayoutMode::Cards;
+    TempUnit tempUnit = TempUnit::Fahrenheit;
+    ThemePreferences themePrefs;
+    int imageCacheMB = 128;  // budget for decoded article images; "imageCacheMB" in config.json
+};
+
+// Settings getters read the current snapshot and are safe on any thread;
+// list getters share it rather than copying. Read, saved and expanded marks
+// are not part of it and belong to the main thread.
 class Config {
 public:
     static Config& getInstance();
     
+    std::shared_ptr<const ConfigSnapshot> snapshot() const;
+    
     // Feed management
-    std::vector<FeedInfo> getFeeds() const;
+    std::shared_ptr<const std::vector<FeedInfo>> getFeeds() const;
     void addFeed(const FeedInfo& feed);
     void updateFeed(const std::string& url, const FeedInfo& feed);
     void removeFeed(const std::string& url);
@@ -65,26 +93,29 @@ public:
     void removeRSSFeed(const std::string& url);
     
     // Category management
-    std::vector<Category> getCategories() const;
+    std::shared_ptr<const std::vector<Category>> getCategories() const;
     void addCategory(const Category& category);
     void updateCategory(const std::string& id, const Category& category);
     void removeCategory(const std::string& id);
     
-    // Read status
-    bool isArticleRead(const std::string& articleId) const;
+    // Read status. Marks of articles that no feed has offered for
+    // kReadExpiryDays before the last noteArticlesSeen() are dropped, then
+    // and at load; feeds report what they still offer through it.
+    static constexpr ReadSet::Day kReadExpiryDays = 90;
+    bool isArticleRead(std::string_view articleId) const;
     void markArticleRead(const std::string& articleId);
     void markArticleUnread(const std::string& articleId);
     void markAllRead(const std::string& feedUrl = "");
-    std::set<std::string> getReadArticles() const;
+    void noteArticlesSeen(const std::vector<std::string_view>& articleIds);
     
     // Save for later
     bool isArticleSaved(const std::string& articleId) const;
     void saveArticle(const std::string& articleId);
     void unsaveArticle(const std::string& articleId);
-    std::set<std::string> getSavedArticles() const;
+    const std::set<std::string>& getSavedArticles() const { return savedArticles_; }
     
     // Weather locations (multiple)
-    std::vector<std::string> getWeatherLocations() const;
+    std::shared_ptr<const std::vector<std::string>> getWeatherLocations() const;
     void addWeatherLocation(const std::string& location);
     void removeWeatherLocation(const std::string& location);
     void setWeatherLocation(const std::string& location); // Legacy - adds if not exists
@@ -95,7 +126,7 @@ public:
     void setTempUnit(TempUnit unit);
     
     // Stocks
-    std::vector<std::string> getStockSymbols() const;
+    std::shared_ptr<const std::vector<std::string>> getStockSymbols() const;
     void addStockSymbol(const std::string& symbol);
     void removeStockSymbol(const std::string& symbol);
     
@@ -107,6 +138,11 @@ public:
     LayoutMode getLayoutMode() const;
     void setLayoutMode(LayoutMode mode);
     
+    // Memory budget for decoded article images, in megabytes. There is no
+    // setting for it in the UI: it comes from the "imageCacheMB" key in
+    // config.json (at least 8) and is applied when the RSS panel is created.
+    int getImageCacheMB() const;
+    
     // Theme preferences
     ThemePreferences getThemePreferences() const;
     void setThemePreferences(const ThemePreferences& prefs);
@@ -117,28 +153,58 @@ public:
     std::string getCustomAccentColor() const;
     void setCustomAccentColor(const std::string& color);
     
+    // Changes are written on a background thread. Read, saved and expanded
+    // marks are appended to a journal next to config.json; anything else
+    // schedules one rewrite of config.json (which also empties the journal)
+    // for about a second later. save() schedules that rewrite;
+    // flush() writes everything pending now and waits for it.
     void save();
+    void flush();
     void load();
+    
+    // Cache directory: $XDG_CACHE_HOME/infodash, or ~/.cache/infodash
+    std::string getCachePath() const;
 
 private:
     Config();
-    ~Config() = default;
+    ~Config();
     Config(const Config&) = delete;
     Config& operator=(const Config&) = delete;
     
+    struct WriteJob {
+        bool fullFile;     // data is a whole config.json, else journal lines
+        std::string data;
+    };
+    
     std::string getConfigPath() const;
-    void ensureDefaults();
+    std::string getJournalPath() const;
+    static void ensureDefaults(ConfigSnapshot& s);
+    // Publish a copy of the snapshot changed by `change`, which returns
+    // false if it changed nothing. Schedules a rewrite of config.json.
+    void update(const std::function<bool(ConfigSnapshot&)>& change);
+    std::string toJson() const;
+    void queueRewrite();
+    void journal(char op, const std::string& id);
+    size_t replayJournal();
+    void writerLoop();
     
-    std::vector<FeedInfo> feeds_;
-    std::vector<Category> categories_;
-    std::set<std::string> readArticles_;
+    std::atomic<std::shared_ptr<const ConfigSnapshot>> snapshot_;
+    std::mutex updateMutex_;  // serializes copy-and-publish
+    
+    ReadSet readArticles_;
+    ReadSet::Day readSeenDay_ = 0;  // of the last noteArticlesSeen(), 0 if none
     std::set<std::string> savedArticles_;
     std::set<std::string> expandedCategories_;
-    std::vector<std::string> weatherLocations_;
-    std::vector<std::string> stockSymbols_;
-    LayoutMode layoutMode_ = LayoutMode::Cards;
-    TempUnit tempUnit_ = TempUnit::Fahrenheit;
-    ThemePreferences themePrefs_;
+    
+    size_t journalLines_ = 0;     // appended since the last rewrite
+    unsigned int saveTimer_ = 0;  // GLib source of a scheduled rewrite
+    std::mutex writeMutex_;
+    std::condition_variable writeCv_;
+    std::deque<WriteJob> writeJobs_;
+    bool writing_ = false;
+    bool flushing_ = false;
+    bool stopping_ = false;
+    std::thread writer_;
 };
 
 }
@@ -0,0 +1,18 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+
+namespace InfoDash {
+
+// Feed timestamps to Unix epoch seconds. Accepts RFC 822/2822 dates as used
+// by RSS ("Wed, 02 Oct 2002 13:00:00 GMT", with or without the weekday or
+// seconds, two- or four-digit years, numeric offsets or US zone names) and
+// RFC 3339 / ISO 8601 as used by Atom ("2002-10-02T10:00:00.5-05:00", or a
+// bare date). No locale, allocation or libc time calls.
+class DateParser {
+public:
+    // 0 if `text` is not a date in one of those forms.
+    static int64_t parse(std::string_view text);
+};
+
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace InfoDash {
+
+// Size-bounded key/value store in a directory under Config::getCachePath().
+// One file per key, named by a hash of the key; writes go through a temp
+// file and a rename so a crash never leaves a torn entry. When the total
+// size passes the cap, least recently used entries are dropped. Reads touch
+// the file, so LRU order survives a restart.
+class DiskCache {
+public:
+    // HTTP responses, feeds and lookups, under http/
+    static DiskCache& getInstance();
+    // Encoded, already scaled article thumbnails and favicons, under thumbs/
+    static DiskCache& thumbnails();
+
+    bool get(const std::string& key, std::string& value);
+    void put(const std::string& key, const std::string& value);
+    void remove(const std::string& key);
+
+private:
+    DiskCache(const std::string& subdir, uint64_t maxBytes);
+    DiskCache(const DiskCache&) = delete;
+    DiskCache& operator=(const DiskCache&) = delete;
+
+    struct Entry {
+        uint64_t size;
+        int64_t lastUse;
+    };
+
+    std::string fileName(const std::string& key) const;
+    void loadIndex();
+    void evict();
+
+    static constexpr uint64_t kHttpBytes = 64ull * 1024 * 1024;
+    static constexpr uint64_t kThumbnailBytes = 128ull * 1024 * 1024;
+
+    std::mutex mutex_;
+    std::string dir_;
+    uint64_t maxBytes_;
+    bool indexed_ = false;
+    std::unordered_map<std::string, Entry> index_;  // file name -> entry
+    uint64_t totalBytes_ = 0;
+    int64_t clock_ = 0;
+};
+
+}
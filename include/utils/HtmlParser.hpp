@@ -1,5 +1,6 @@
 #pragma once
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
 #include <libxml/HTMLparser.h>
@@ -17,6 +18,22 @@ public:
     std::string getAttribute(const std::string& xpath, const std::string& attr);
     static std::vector<std::map<std::string, std::string>> parseRSSItems(const std::string& xml);
 
+    // Feed description helpers shared by parseRSSItems and FeedParser.
+    static std::string extractImageFromHtml(const std::string& html);
+    static std::string summarizeDescription(const std::string& html);
+
+    // Single-pass HTML to plain text: drops tags and comments, decodes named
+    // and numeric entities, trims, and cuts to maxBytes (on a UTF-8 boundary)
+    // with "..." appended. If firstImage is given it receives the first
+    // <img src> found in the same scan.
+    static std::string htmlToText(std::string_view html, size_t maxBytes,
+                                  std::string* firstImage = nullptr);
+    static constexpr size_t kDescriptionLimit = 200;
+
+    // Resolves an absolute, scheme-relative, root-relative or relative
+    // href against the URL of the page it appeared on.
+    static std::string resolveUrl(const std::string& base, const std::string& href);
+
 private:
     htmlDocPtr doc_;
     xmlXPathContextPtr xpathCtx_;
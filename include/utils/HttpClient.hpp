@@ -1,11 +1,16 @@
 #pragma once
+#include <atomic>
+#include <memory>
 #include <string>
 #include <functional>
+#include <future>
 #include <map>
 #include <vector>
 
 namespace InfoDash {
 
+// Thin per-caller facade over HttpEngine. Instances only carry request
+// defaults (user agent, timeout); every transfer runs on the shared engine.
 class HttpClient {
 public:
     HttpClient();
@@ -17,18 +22,49 @@ public:
         std::map<std::string, std::string> headers;
         bool success;
         std::string error;
+
+        // Case-insensitive header lookup; empty if absent.
+        std::string header(const std::string& name) const;
+    };
+
+    struct Request {
+        std::string url;
+        std::string userAgent;
+        long timeoutSeconds = 30;
+        std::map<std::string, std::string> headers;
+        // Optional body chunk sink, called on the engine I/O thread as data
+        // arrives (the body is still collected into Response::body). Must be
+        // cheap; hand real work to a worker.
+        std::function<void(const char* data, size_t size)> onData;
+        // Optional cancellation flag. Once set, a queued transfer is never
+        // started and a running one is aborted at its next write or progress
+        // tick; either way the callback still runs, with an error. onData may
+        // set it to stop a download early.
+        std::shared_ptr<std::atomic<bool>> cancelled;
     };
 
+    // Blocking calls. Must not be used from an HttpEngine completion.
     Response get(const std::string& url);
     std::vector<unsigned char> getBytes(const std::string& url);
-    void getAsync(const std::string& url, std::function<void(Response)> callback);
+
+    // Non-blocking calls. getAsync runs the callback on an engine worker thread.
+    void getAsync(const std::string& url, std::function<void(Response)> callback,
+                  const std::map<std::string, std::string>& headers = {});
+    void getAsync(Request request, std::function<void(Response)> callback);
+    std::future<Response> fetch(const std::string& url);
+
+    // Persistent response cache (DiskCache) for warm startup. Callers store
+    // a response once they know it parsed, and read it back offline.
+    static bool getCached(const std::string& url, Response& response);
+    static void storeCached(const std::string& url, const Response& response);
+
     void setUserAgent(const std::string& userAgent);
     void setTimeout(long timeoutSeconds);
 
+    // A request for `url` carrying this client's defaults.
+    Request makeRequest(const std::string& url) const;
+
 private:
-    static size_t writeCallback(void* contents, size_t size, size_t nmemb, void* userp);
-    static size_t writeBytesCallback(void* contents, size_t size, size_t nmemb, void* userp);
-    static size_t headerCallback(char* buffer, size_t size, size_t nitems, void* userdata);
     std::string userAgent_;
     long timeout_;
 };
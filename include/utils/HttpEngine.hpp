@@ -0,0 +1,81 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#include <curl/curl.h>
+#include "utils/HttpClient.hpp"
+#include "utils/ThreadPool.hpp"
+
+namespace InfoDash {
+
+// Process-wide transfer engine: one curl_multi event loop on a dedicated I/O
+// thread, a bounded number of transfers in flight, and a small worker pool
+// for running completion callbacks that do real work (parsing, decoding).
+class HttpEngine {
+public:
+    using Completion = std::function<void(HttpClient::Response)>;
+
+    // Reuse counters since startup. A transfer counts as a reused connection
+    // when curl opened no new connection for it (CURLINFO_NUM_CONNECTS == 0).
+    struct Stats {
+        uint64_t requests;
+        uint64_t reusedConnections;
+        uint64_t newConnections;
+        uint64_t pooledHandles;   // easy handles taken from the idle pool
+    };
+
+    static HttpEngine& getInstance();
+
+    // Queue a transfer. `done` runs on the I/O thread, so it must be cheap
+    // and must never block on another transfer; hand off work via post().
+    void submit(HttpClient::Request request, Completion done);
+
+    // Run a task on the completion worker pool.
+    void post(std::function<void()> task);
+
+    Stats stats() const;
+
+private:
+    HttpEngine();
+    ~HttpEngine();
+    HttpEngine(const HttpEngine&) = delete;
+    HttpEngine& operator=(const HttpEngine&) = delete;
+
+    struct Transfer;
+
+    void run();
+    CURL* acquireHandle();
+    void releaseHandle(CURL* easy);
+    void startPending();
+    void finish(CURL* easy, CURLcode result);
+    void abortAll();
+
+    static size_t writeCallback(void* contents, size_t size, size_t nmemb, void* userp);
+    static size_t headerCallback(char* buffer, size_t size, size_t nitems, void* userdata);
+    static int progressCallback(void* clientp, curl_off_t dltotal, curl_off_t dlnow,
+                                curl_off_t ultotal, curl_off_t ulnow);
+
+    static constexpr size_t kMaxInFlight = 24;
+
+    CURLM* multi_;
+    CURLSH* share_;                   // DNS, connection and TLS session caches
+    std::vector<CURL*> idleHandles_;  // I/O thread only
+    std::mutex mutex_;
+    std::deque<std::unique_ptr<Transfer>> pending_;
+    std::unordered_set<Transfer*> inFlight_;  // I/O thread only
+    std::atomic<bool> running_;
+    std::atomic<uint64_t> requests_{0};
+    std::atomic<uint64_t> reusedConnections_{0};
+    std::atomic<uint64_t> newConnections_{0};
+    std::atomic<uint64_t> pooledHandles_{0};
+    ThreadPool workers_;
+    std::thread ioThread_;
+};
+
+}
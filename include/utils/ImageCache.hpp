@@ -0,0 +1,67 @@
+#pragma once
+#include <gdk/gdk.h>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+namespace InfoDash {
+
+// Article image textures, decoded at display size, by key (the image URL
+// and the size it was decoded for). Bounded by pixel bytes: when an insert
+// takes the total past the budget, least recently shown textures are
+// dropped; whoever asks for one again gets a miss and fetches it anew.
+// Widgets keep their own reference, so eviction never blanks what is on
+// screen. Main thread only. The RSS panel logs stats() with g_debug after
+// each refresh (run with G_MESSAGES_DEBUG=all to see it).
+class ImageCache {
+public:
+    struct Stats {
+        uint64_t hits;
+        uint64_t misses;
+        uint64_t evictions;
+        size_t bytes;     // pixel data held now
+        size_t entries;
+    };
+
+    static ImageCache& getInstance();
+
+    // The texture for `key`, or null. A hit makes it the most recently used.
+    // The cache keeps its reference; take one to hold it past the next insert.
+    GdkTexture* lookup(const std::string& key);
+
+    // Adopts the caller's reference. Replaces a texture already held for `key`.
+    void insert(const std::string& key, GdkTexture* texture);
+
+    void setBudget(size_t bytes);
+    size_t budget() const { return budget_; }
+
+    Stats stats() const;
+    void clear();
+
+private:
+    ImageCache() = default;
+    ~ImageCache();
+    ImageCache(const ImageCache&) = delete;
+    ImageCache& operator=(const ImageCache&) = delete;
+
+    struct Entry {
+        std::string key;
+        GdkTexture* texture;
+        size_t bytes;
+    };
+
+    void evict();
+
+    static constexpr size_t kDefaultBudget = 128u * 1024 * 1024;
+
+    std::list<Entry> lru_;  // most recently used first
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+    size_t budget_ = kDefaultBudget;
+    size_t bytes_ = 0;
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+    uint64_t evictions_ = 0;
+};
+
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <gdk/gdk.h>
+#include <gdk-pixbuf/gdk-pixbuf.h>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace InfoDash {
+
+// Turns downloaded image bytes into textures sized for display. Each image
+// is decoded straight to the box it is shown in (the loader scales while
+// decoding, so a large JPEG never exists at full size) on a small set of
+// decoder threads. The queue is bounded: when it is full the oldest request,
+// most likely for a card already scrolled away, is dropped.
+class ImageDecoder {
+public:
+    // Runs on a decoder thread. `texture` is the caller's reference, or null
+    // if the data could not be decoded or the request was dropped.
+    using Done = std::function<void(GdkTexture* texture, bool dropped)>;
+
+    static ImageDecoder& getInstance();
+
+    // Decode `data` to fit within width x height pixels, keeping its aspect.
+    // With a `storeKey`, the scaled image is also written to
+    // DiskCache::thumbnails() under it, so it need not be fetched again.
+    void decode(std::string data, int width, int height, std::string storeKey, Done done);
+
+    // Scaled image, or null; synchronous on the calling thread.
+    static GdkPixbuf* decodeAtSize(const std::string& data, int width, int height);
+
+    // Compact encoding for the thumbnail cache: JPEG, or PNG if the image
+    // has transparency. Empty on failure.
+    static std::string encode(GdkPixbuf* pixbuf);
+
+private:
+    ImageDecoder();
+    ~ImageDecoder();
+    ImageDecoder(const ImageDecoder&) = delete;
+    ImageDecoder& operator=(const ImageDecoder&) = delete;
+
+    struct Job {
+        std::string data;
+        int width;
+        int height;
+        std::string storeKey;
+        Done done;
+    };
+
+    void workerLoop();
+
+    static constexpr size_t kThreads = 2;
+    static constexpr size_t kMaxQueued = 32;
+
+    std::vector<std::thread> workers_;
+    std::deque<Job> jobs_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stopping_ = false;
+};
+
+}
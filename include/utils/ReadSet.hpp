@@ -0,0 +1,53 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace InfoDash {
+
+// Set of article IDs (URLs) kept as 64-bit hashes in an open-addressing
+// table, each with the day it was last marked or seen in a feed. Lookups
+// hash the ID once and probe a flat array; entries take 10 bytes plus
+// table slack. Entries for articles no feed offers any more can be expired
+// by age, so the set stays the size of what is actually being read.
+//
+// Hash collisions (about one in 10^10 at 10k entries) only show an
+// unread article as read.
+class ReadSet {
+public:
+    using Day = uint16_t;  // days since 1970-01-01
+
+    static uint64_t hash(std::string_view id);
+    static Day today();
+
+    bool contains(std::string_view id) const { return contains(hash(id)); }
+    bool contains(uint64_t h) const;
+    // True if the entry is new. An existing entry gets its day bumped.
+    bool insert(uint64_t h, Day day);
+    bool erase(uint64_t h);
+    // Bump the day of an existing entry; false if there is none or it
+    // already had that day.
+    bool touch(uint64_t h, Day day);
+    // Drop entries last marked or seen before `cutoff`; returns how many.
+    size_t expire(Day cutoff);
+
+    size_t size() const { return size_; }
+    void clear();
+    size_t memoryUsage() const;
+
+    // Compact text form for config.json: 20 hex digits per entry (hash,
+    // day). decode() adds to the set and skips malformed records.
+    std::string encode() const;
+    void decode(std::string_view text);
+
+private:
+    size_t slot(uint64_t h) const;
+    void grow();
+
+    std::vector<uint64_t> keys_;  // 0 marks an empty slot
+    std::vector<Day> days_;
+    size_t size_ = 0;
+};
+
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace InfoDash {
+
+// Hands work from any thread to the GTK main thread. Tasks posted within
+// one frame interval run together, in posting order, from a single main
+// loop source, so a burst of completions costs one wakeup and one redraw
+// rather than one idle source each.
+class UiDispatcher {
+public:
+    static UiDispatcher& getInstance();
+
+    void post(std::function<void()> task);
+    // Same, but not before `delayMs` have passed: for gathering results
+    // that trickle in over a while into one task.
+    void postAfter(unsigned delayMs, std::function<void()> task);
+
+private:
+    UiDispatcher() = default;
+    UiDispatcher(const UiDispatcher&) = delete;
+    UiDispatcher& operator=(const UiDispatcher&) = delete;
+
+    static int dispatch(void* self);
+
+    static constexpr unsigned kFrameMs = 16;
+
+    std::mutex mutex_;
+    std::vector<std::function<void()>> tasks_;
+    bool scheduled_ = false;
+};
+
+}
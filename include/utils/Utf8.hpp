@@ -0,0 +1,19 @@
+#pragma once
+#include <string>
+#include <string_view>
+
+namespace InfoDash {
+
+// Strict UTF-8 validation (no overlongs, surrogates or code points past
+// U+10FFFF) shared by the services. Picks an AVX2, SSE2 or scalar kernel at
+// first use based on the running CPU.
+class Utf8 {
+public:
+    static bool isValid(std::string_view text);
+
+    // Returns `text` itself, moved and uncopied, when it is already valid;
+    // otherwise a copy with every invalid byte dropped.
+    static std::string sanitize(std::string text);
+};
+
+}
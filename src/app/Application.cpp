@@ -42,8 +42,8 @@ void Application::onActivate(GtkApplication* app, gpointer userData) {
 }
 
 void Application::onShutdown(GtkApplication* /*app*/, gpointer /*userData*/) {
-    // Save configuration on shutdown
-    Config::getInstance().save();
+    // Write out pending configuration changes on shutdown
+    Config::getInstance().flush();
 }
 
 } // namespace InfoDash
@@ -0,0 +1,456 @@
+#include "services/ArticleArchive.hpp"
+#include "utils/Config.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+namespace InfoDash {
+
+// Log layout: "IDALOG1\n", a 64-bit generation (new on every rewrite, so a
+// stale index is never applied to a compacted log), then records of
+//   u32 size (whole record), u32 checksum (of what follows),
+//   u64 key, i64 pubTime, u64 contentHash,
+//   8 x (u32 length, bytes): feed URL, guid, title, link, description,
+//   pubDate, image URL, author.
+// Integers are in host byte order; the files never leave this machine.
+static const char kLogMagic[8] = {'I', 'D', 'A', 'L', 'O', 'G', '1', '\n'};
+static const char kIndexMagic[8] = {'I', 'D', 'A', 'I', 'D', 'X', '2', '\n'};
+static constexpr uint64_t kLogHeader = 16;
+static constexpr uint32_t kRecordHeader = 8;
+static constexpr uint32_t kRecordFixed = kRecordHeader + 24;
+static constexpr uint64_t kCompactMinBytes = 4ull * 1024 * 1024;
+
+static uint64_t hash64(std::string_view s, uint64_t h = 1469598103934665603ull) {
+    for (unsigned char c : s) {
+        h ^= c;
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+static uint32_t checksum(const char* data, size_t size) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < size; ++i) {
+        h ^= static_cast<unsigned char>(data[i]);
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static uint64_t articleKey(const RSSItem& item) {
+    return hash64(item.guid.empty() ? item.link : item.guid);
+}
+
+static uint64_t contentHash(const RSSItem& item) {
+    uint64_t h = hash64(item.title);
+    for (const std::string* field : {&item.link, &item.description, &item.pubDate, &item.imageUrl, &item.author}) {
+        h = hash64(std::string_view("\0", 1), h);
+        h = hash64(*field, h);
+    }
+    return h;
+}
+
+template <typename T>
+static void put(std::string& out, T value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+static void putString(std::string& out, const std::string& s) {
+    put<uint32_t>(out, static_cast<uint32_t>(s.size()));
+    out += s;
+}
+
+// Bounds-checked reader over a record or index buffer.
+struct Reader {
+    const char* p;
+    const char* end;
+
+    template <typename T>
+    bool get(T& value) {
+        if (static_cast<size_t>(end - p) < sizeof(T)) return false;
+        std::memcpy(&value, p, sizeof(T));
+        p += sizeof(T);
+        return true;
+    }
+
+    bool getString(std::string& s) {
+        uint32_t len = 0;
+        if (!get(len) || static_cast<size_t>(end - p) < len) return false;
+        s.assign(p, len);
+        p += len;
+        return true;
+    }
+
+    bool skipString() {
+        uint32_t len = 0;
+        if (!get(len) || static_cast<size_t>(end - p) < len) return false;
+        p += len;
+        return true;
+    }
+};
+
+static uint64_t newGeneration() {
+    std::random_device rd;
+    uint64_t g = (static_cast<uint64_t>(rd()) << 32) ^ rd();
+    return g ^ static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+}
+
+static std::string encodeRecord(uint64_t key, uint64_t hash, const std::string& feedUrl, const RSSItem& item) {
+    std::string rec(kRecordHeader, '\0');
+    put<uint64_t>(rec, key);
+    put<int64_t>(rec, item.pubTime);
+    put<uint64_t>(rec, hash);
+    for (const std::string* field : {&feedUrl, &item.guid, &item.title, &item.link, &item.description,
+                                     &item.pubDate, &item.imageUrl, &item.author}) {
+        putString(rec, *field);
+    }
+    uint32_t size = static_cast<uint32_t>(rec.size());
+    uint32_t sum = checksum(rec.data() + kRecordHeader, rec.size() - kRecordHeader);
+    std::memcpy(rec.data(), &size, 4);
+    std::memcpy(rec.data() + 4, &sum, 4);
+    return rec;
+}
+
+static bool writeAll(int fd, const std::string& data) {
+    const char* p = data.data();
+    size_t left = data.size();
+    while (left > 0) {
+        ssize_t n = ::write(fd, p, left);
+        if (n < 0) return false;
+        p += n;
+        left -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+ArticleArchive& ArticleArchive::getInstance() {
+    static ArticleArchive instance;
+    return instance;
+}
+
+ArticleArchive::ArticleArchive() : dir_(Config::getInstance().getCachePath() + "/articles") {}
+
+ArticleArchive::~ArticleArchive() {
+    flush();
+    if (map_) munmap(const_cast<char*>(map_), mapSize_);
+    if (fd_ >= 0) ::close(fd_);
+}
+
+uint32_t ArticleArchive::feedId(const std::string& url) {
+    auto it = feedIds_.find(url);
+    if (it != feedIds_.end()) return it->second;
+    uint32_t id = static_cast<uint32_t>(feeds_.size());
+    feeds_.push_back({url, {}, true});
+    feedIds_.emplace(url, id);
+    return id;
+}
+
+void ArticleArchive::open() {
+    if (fd_ >= 0) return;
+    std::error_code ec;
+    fs::create_directories(dir_, ec);
+    fd_ = ::open((dir_ + "/articles.log").c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (fd_ < 0) return;
+
+    struct stat st {};
+    fstat(fd_, &st);
+    logSize_ = static_cast<uint64_t>(st.st_size);
+    char header[kLogHeader];
+    if (logSize_ < kLogHeader || pread(fd_, header, kLogHeader, 0) != kLogHeader ||
+        std::memcmp(header, kLogMagic, sizeof(kLogMagic)) != 0) {
+        // New or unreadable: start over.
+        if (ftruncate(fd_, 0) != 0) return;
+        std::string fresh(kLogMagic, sizeof(kLogMagic));
+        put<uint64_t>(fresh, newGeneration());
+        if (!writeAll(fd_, fresh)) return;
+        logSize_ = kLogHeader;
+    }
+    remap();
+    if (!loadIndex()) replay(kLogHeader);
+    for (auto& feed : feeds_) trimFeed(feed);
+}
+
+bool ArticleArchive::remap() {
+    if (logSize_ == mapSize_ && map_) return true;
+    if (map_) munmap(const_cast<char*>(map_), mapSize_);
+    map_ = nullptr;
+    mapSize_ = 0;
+    void* p = mmap(nullptr, logSize_, PROT_READ, MAP_SHARED, fd_, 0);
+    if (p == MAP_FAILED) return false;
+    map_ = static_cast<const char*>(p);
+    mapSize_ = logSize_;
+    return true;
+}
+
+void ArticleArchive::indexRecord(uint64_t key, const Entry& entry) {
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+        liveBytes_ -= it->second.size;
+        if (it->second.feed != entry.feed) {
+            auto& keys = feeds_[it->second.feed].keys;
+            keys.erase(std::remove(keys.begin(), keys.end(), key), keys.end());
+            feeds_[entry.feed].keys.push_back(key);
+        }
+        it->second = entry;
+    } else {
+        entries_.emplace(key, entry);
+        feeds_[entry.feed].keys.push_back(key);
+    }
+    feeds_[entry.feed].sorted = false;
+    liveBytes_ += entry.size;
+}
+
+// Index every record from `from` to the end of the log. A torn or corrupt
+// tail (from a crash mid-append) is cut off.
+void ArticleArchive::replay(uint64_t from) {
+    uint64_t pos = from;
+    while (pos + kRecordFixed <= mapSize_) {
+        uint32_t size = 0, sum = 0;
+        std::memcpy(&size, map_ + pos, 4);
+        std::memcpy(&sum, map_ + pos + 4, 4);
+        if (size < kRecordFixed || pos + size > mapSize_ ||
+            checksum(map_ + pos + kRecordHeader, size - kRecordHeader) != sum) {
+            break;
+        }
+        Reader r{map_ + pos + kRecordHeader, map_ + pos + size};
+        Entry e{pos, 0, 0, 0, size};
+        uint64_t key = 0;
+        std::string feedUrl;
+        r.get(key);
+        r.get(e.pubTime);
+        r.get(e.contentHash);
+        if (!r.getString(feedUrl)) break;
+        e.feed = feedId(feedUrl);
+        indexRecord(key, e);
+        pos += size;
+    }
+    if (pos < logSize_) {
+        if (ftruncate(fd_, static_cast<off_t>(pos)) == 0) {
+            logSize_ = pos;
+            remap();
+        }
+    }
+    if (pos > from) dirty_ = true;
+}
+
+void ArticleArchive::sortFeed(Feed& feed) {
+    if (feed.sorted) return;
+    // Newest first; undated articles by arrival, latest first.
+    std::sort(feed.keys.begin(), feed.keys.end(), [this](uint64_t a, uint64_t b) {
+        const Entry& ea = entries_.at(a);
+        const Entry& eb = entries_.at(b);
+        return ea.pubTime != eb.pubTime ? ea.pubTime > eb.pubTime : ea.offset > eb.offset;
+    });
+    feed.sorted = true;
+}
+
+void ArticleArchive::trimFeed(Feed& feed) {
+    if (feed.keys.size() <= kMaxPerFeed) return;
+    sortFeed(feed);
+    for (size_t i = kMaxPerFeed; i < feed.keys.size(); ++i) {
+        auto it = entries_.find(feed.keys[i]);
+        liveBytes_ -= it->second.size;
+        entries_.erase(it);
+    }
+    feed.keys.resize(kMaxPerFeed);
+    dirty_ = true;
+}
+
+bool ArticleArchive::readRecord(const Entry& entry, RSSItem& item) const {
+    if (entry.offset + entry.size > mapSize_) return false;
+    Reader r{map_ + entry.offset + kRecordHeader, map_ + entry.offset + entry.size};
+    uint64_t key = 0, hash = 0;
+    return r.get(key) && r.get(item.pubTime) && r.get(hash) && r.skipString() &&
+           r.getString(item.guid) && r.getString(item.title) && r.getString(item.link) &&
+           r.getString(item.description) && r.getString(item.pubDate) &&
+           r.getString(item.imageUrl) && r.getString(item.author);
+}
+
+std::vector<RSSItem> ArticleArchive::merge(const std::string& feedUrl, const std::vector<RSSItem>& items) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        open();
+        if (fd_ < 0) return items;
+
+        uint32_t id = feedId(feedUrl);
+        std::string batch;
+        std::vector<std::pair<uint64_t, Entry>> added;
+        for (const auto& item : items) {
+            if (item.guid.empty() && item.link.empty()) continue;
+            uint64_t key = articleKey(item);
+            uint64_t hash = contentHash(item);
+            auto it = entries_.find(key);
+            if (it != entries_.end() && it->second.contentHash == hash && it->second.feed == id) continue;
+
+            std::string rec = encodeRecord(key, hash, feedUrl, item);
+            Entry e{logSize_ + batch.size(), hash, item.pubTime, id, static_cast<uint32_t>(rec.size())};
+            added.emplace_back(key, e);
+            batch += rec;
+        }
+        if (!batch.empty()) {
+            if (!writeAll(fd_, batch)) {
+                // Drop whatever part made it; the next replay would too.
+                if (ftruncate(fd_, static_cast<off_t>(logSize_)) != 0) return items;
+            } else {
+                logSize_ += batch.size();
+                for (const auto& [key, e] : added) indexRecord(key, e);
+                trimFeed(feeds_[id]);
+                dirty_ = true;
+                remap();
+            }
+        }
+    }
+    return feedItems(feedUrl);
+}
+
+std::vector<RSSItem> ArticleArchive::feedItems(const std::string& feedUrl, size_t limit) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    open();
+    std::vector<RSSItem> items;
+    auto it = feedIds_.find(feedUrl);
+    if (it == feedIds_.end()) return items;
+    Feed& feed = feeds_[it->second];
+    sortFeed(feed);
+    items.reserve(std::min(limit, feed.keys.size()));
+    for (uint64_t key : feed.keys) {
+        if (items.size() == limit) break;
+        RSSItem item;
+        if (readRecord(entries_.at(key), item)) items.push_back(std::move(item));
+    }
+    return items;
+}
+
+// Index file: magic, log generation, log size covered, feed URLs, entries.
+bool ArticleArchive::loadIndex() {
+    if (!map_ || mapSize_ < kLogHeader) return false;  // log unreadable; replay finds nothing
+    std::ifstream in(dir_ + "/articles.idx", std::ios::binary);
+    if (!in) return false;
+    std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    Reader r{data.data(), data.data() + data.size()};
+
+    uint64_t generation = 0, covered = 0, logGeneration = 0, count = 0;
+    uint32_t feedCount = 0;
+    std::memcpy(&logGeneration, map_ + sizeof(kLogMagic), sizeof(logGeneration));
+    if (data.size() < sizeof(kIndexMagic) || std::memcmp(data.data(), kIndexMagic, sizeof(kIndexMagic)) != 0) {
+        return false;
+    }
+    r.p += sizeof(kIndexMagic);
+    if (!r.get(generation) || generation != logGeneration || !r.get(covered) || covered > logSize_ ||
+        covered < kLogHeader || !r.get(feedCount)) {
+        return false;
+    }
+
+    std::vector<std::string> urls(feedCount);
+    for (auto& url : urls) {
+        if (!r.getString(url)) return false;
+    }
+    if (!r.get(count)) return false;
+    std::vector<std::pair<uint64_t, Entry>> loaded;
+    loaded.reserve(count);
+    for (uint64_t i = 0; i < count; ++i) {
+        uint64_t key = 0;
+        Entry e{};
+        if (!r.get(key) || !r.get(e.offset) || !r.get(e.contentHash) || !r.get(e.pubTime) ||
+            !r.get(e.feed) || !r.get(e.size)) {
+            return false;
+        }
+        if (e.feed >= feedCount || e.offset + e.size > covered) return false;
+        loaded.emplace_back(key, e);
+    }
+
+    for (const auto& url : urls) feedId(url);
+    for (const auto& [key, e] : loaded) indexRecord(key, e);
+    replay(covered);
+    return true;
+}
+
+void ArticleArchive::saveIndex() {
+    std::string out(kIndexMagic, sizeof(kIndexMagic));
+    uint64_t generation = 0;
+    std::memcpy(&generation, map_ + sizeof(kLogMagic), sizeof(generation));
+    put<uint64_t>(out, generation);
+    put<uint64_t>(out, logSize_);
+    put<uint32_t>(out, static_cast<uint32_t>(feeds_.size()));
+    for (const auto& feed : feeds_) putString(out, feed.url);
+    put<uint64_t>(out, entries_.size());
+    for (const auto& [key, e] : entries_) {
+        put<uint64_t>(out, key);
+        put<uint64_t>(out, e.offset);
+        put<uint64_t>(out, e.contentHash);
+        put<int64_t>(out, e.pubTime);
+        put<uint32_t>(out, e.feed);
+        put<uint32_t>(out, e.size);
+    }
+
+    std::string path = dir_ + "/articles.idx";
+    {
+        std::ofstream tmp(path + ".tmp", std::ios::binary | std::ios::trunc);
+        if (!tmp) return;
+        tmp.write(out.data(), static_cast<std::streamsize>(out.size()));
+        if (!tmp) return;
+    }
+    std::error_code ec;
+    fs::rename(path + ".tmp", path, ec);
+}
+
+// Rewrite the log with live records only, under a new generation.
+void ArticleArchive::compact() {
+    std::string path = dir_ + "/articles.log";
+    std::string out(kLogMagic, sizeof(kLogMagic));
+    put<uint64_t>(out, newGeneration());
+    out.reserve(kLogHeader + liveBytes_);
+    std::unordered_map<uint64_t, uint64_t> offsets;
+    offsets.reserve(entries_.size());
+    for (auto& feed : feeds_) {
+        sortFeed(feed);
+        // Oldest first, so a replay sees them in their original order.
+        for (auto it = feed.keys.rbegin(); it != feed.keys.rend(); ++it) {
+            const Entry& e = entries_.at(*it);
+            offsets[*it] = out.size();
+            out.append(map_ + e.offset, e.size);
+        }
+    }
+    {
+        std::ofstream tmp(path + ".tmp", std::ios::binary | std::ios::trunc);
+        if (!tmp) return;
+        tmp.write(out.data(), static_cast<std::streamsize>(out.size()));
+        if (!tmp) return;
+    }
+    int fd = ::open((path + ".tmp").c_str(), O_RDWR | O_APPEND | O_CLOEXEC);
+    if (fd < 0) return;
+    std::error_code ec;
+    fs::rename(path + ".tmp", path, ec);
+    if (ec) {
+        ::close(fd);
+        return;
+    }
+
+    if (map_) munmap(const_cast<char*>(map_), mapSize_);
+    map_ = nullptr;
+    mapSize_ = 0;
+    ::close(fd_);
+    fd_ = fd;
+    logSize_ = out.size();
+    for (auto& [key, e] : entries_) e.offset = offsets.at(key);
+    liveBytes_ = logSize_ - kLogHeader;
+    remap();
+}
+
+void ArticleArchive::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!dirty_ || fd_ < 0 || !map_) return;
+    if (logSize_ > kCompactMinBytes && liveBytes_ * 2 < logSize_) compact();
+    saveIndex();
+    dirty_ = false;
+}
+
+}
@@ -0,0 +1,173 @@
+#include "services/ArticleImages.hpp"
+#include "utils/DiskCache.hpp"
+#include "utils/HtmlParser.hpp"
+#include "utils/HttpClient.hpp"
+#include "utils/HttpEngine.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+namespace InfoDash {
+
+// Pages that never close their head are cut off here.
+static constexpr size_t kMaxHeadBytes = 256 * 1024;
+
+// Watches the body as it streams in and cancels the transfer at the end of
+// the head. Runs on the engine I/O thread, so it only looks at each chunk
+// plus a few bytes carried over from the previous one.
+struct HeadScan {
+    std::shared_ptr<std::atomic<bool>> cancelled = std::make_shared<std::atomic<bool>>(false);
+    std::string tail;
+    size_t received = 0;
+    bool complete = false;
+    bool truncated = false;  // cut off at kMaxHeadBytes without </head>
+
+    void push(const char* data, size_t size) {
+        received += size;
+        std::string window = tail;
+        window.append(data, size);
+        std::transform(window.begin(), window.end(), window.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        if (window.find("</head") != std::string::npos || window.find("<body") != std::string::npos) {
+            complete = true;
+        }
+        if (complete || received >= kMaxHeadBytes) {
+            truncated = !complete;
+            cancelled->store(true);
+            return;
+        }
+        tail = window.substr(window.size() - std::min<size_t>(window.size(), 5));
+    }
+};
+
+static std::string imageFromHead(const std::string& link, const std::string& head) {
+    HtmlParser parser;
+    if (!parser.parse(head)) return "";
+    std::string img = parser.getAttribute("//meta[@property='og:image']", "content");
+    if (img.empty()) img = parser.getAttribute("//meta[@name='twitter:image']", "content");
+    if (img.empty()) img = parser.getAttribute("//link[@rel='image_src']", "href");
+    if (img.empty()) return "";
+    return HtmlParser::resolveUrl(link, img);
+}
+
+ArticleImages& ArticleImages::getInstance() {
+    static ArticleImages instance;
+    return instance;
+}
+
+// "No image" is stored on disk with the day it was found, so it can expire.
+static constexpr const char* kNoImage = "none:";
+
+static int64_t today() {
+    return std::chrono::duration_cast<std::chrono::hours>(
+               std::chrono::system_clock::now().time_since_epoch()).count() / 24;
+}
+
+bool ArticleImages::lookup(const std::string& link, std::string& imageUrl) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = resolved_.find(link);
+        if (it != resolved_.end()) {
+            imageUrl = it->second;
+            return true;
+        }
+    }
+    std::string stored;
+    if (!DiskCache::getInstance().get("ogimage:" + link, stored)) return false;
+    if (stored.rfind(kNoImage, 0) == 0 || stored.empty()) {
+        // Entries from before expiry was kept carry no day and count as stale.
+        int64_t day = stored.empty() ? 0 : std::strtoll(stored.c_str() + strlen(kNoImage), nullptr, 10);
+        if (today() - day >= kNoImageDays) return false;
+        stored.clear();
+    }
+    remember(link, stored);
+    imageUrl = std::move(stored);
+    return true;
+}
+
+void ArticleImages::remember(const std::string& link, const std::string& imageUrl) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (resolved_.size() >= kMaxRemembered) resolved_.clear();
+    resolved_[link] = imageUrl;
+}
+
+void ArticleImages::resolve(const std::vector<std::string>& links, Callback onImage) {
+    if (links.empty()) return;
+    HttpEngine::getInstance().post([this, links, onImage = std::move(onImage)]() {
+        resolveNow(links, onImage);
+    });
+}
+
+void ArticleImages::resolveNow(const std::vector<std::string>& links, const Callback& onImage) {
+    for (const auto& link : links) {
+        if (link.empty()) continue;
+        std::string imageUrl;
+        if (lookup(link, imageUrl)) {
+            if (!imageUrl.empty()) onImage(link, imageUrl);
+            continue;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto [it, added] = waiting_.try_emplace(link);
+        it->second.push_back(onImage);
+        if (added) queue_.push_back(link);
+    }
+    startNext();
+}
+
+void ArticleImages::startNext() {
+    for (;;) {
+        std::string link;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (queue_.empty() || active_ >= kMaxConcurrent) return;
+            link = std::move(queue_.front());
+            queue_.pop_front();
+            ++active_;
+        }
+
+        auto scan = std::make_shared<HeadScan>();
+        HttpClient client;
+        client.setTimeout(10);
+        HttpClient::Request request = client.makeRequest(link);
+        request.cancelled = scan->cancelled;
+        request.onData = [scan](const char* data, size_t size) { scan->push(data, size); };
+        client.getAsync(std::move(request), [this, link, scan](HttpClient::Response response) {
+            // The transfer is aborted on purpose at </head>, or at the size
+            // cap for pages that never close it, which curl reports as an
+            // error; what arrived is in the body either way.
+            bool cut = scan->complete || scan->truncated;
+            bool gotHead = response.success || (cut && response.statusCode / 100 == 2);
+            std::string imageUrl = gotHead ? imageFromHead(link, response.body) : "";
+            finish(link, imageUrl, gotHead);
+        });
+    }
+}
+
+void ArticleImages::finish(const std::string& link, const std::string& imageUrl, bool cacheable) {
+    std::vector<Callback> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --active_;
+        auto it = waiting_.find(link);
+        if (it != waiting_.end()) {
+            callbacks = std::move(it->second);
+            waiting_.erase(it);
+        }
+    }
+    // Network failures are not remembered, so the next refresh retries.
+    if (cacheable) {
+        remember(link, imageUrl);
+        std::string stored = imageUrl.empty() ? kNoImage + std::to_string(today()) : imageUrl;
+        DiskCache::getInstance().put("ogimage:" + link, stored);
+    }
+    if (!imageUrl.empty()) {
+        for (const auto& cb : callbacks) cb(link, imageUrl);
+    }
+    startNext();
+}
+
+}
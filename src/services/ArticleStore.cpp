@@ -0,0 +1,105 @@
+#include "services/ArticleStore.hpp"
+
+namespace InfoDash {
+
+uint32_t ArticleStore::Interner::intern(std::string_view name) {
+    auto it = ids_.find(name);
+    if (it != ids_.end()) return it->second;
+    uint32_t id = static_cast<uint32_t>(names_.size());
+    names_.emplace_back(name);
+    ids_.emplace(names_.back(), id);
+    return id;
+}
+
+uint32_t ArticleStore::Interner::find(std::string_view name) const {
+    auto it = ids_.find(name);
+    return it == ids_.end() ? kNoId : it->second;
+}
+
+size_t ArticleStore::Interner::memoryUsage() const {
+    size_t bytes = ids_.bucket_count() * sizeof(void*) +
+                   ids_.size() * (sizeof(std::string_view) + sizeof(uint32_t) + 2 * sizeof(void*));
+    for (const auto& name : names_) {
+        bytes += sizeof(std::string);
+        if (name.capacity() > std::string().capacity()) bytes += name.capacity() + 1;
+    }
+    return bytes;
+}
+
+void ArticleStore::Interner::clear() {
+    ids_.clear();
+    names_.clear();
+}
+
+ArticleStore::Span ArticleStore::append(std::string_view text) {
+    Span s{static_cast<uint32_t>(arena_.size()), static_cast<uint32_t>(text.size())};
+    arena_.append(text);
+    arena_.push_back('\0');
+    return s;
+}
+
+ArticleStore::Index ArticleStore::add(const RSSItem& item) {
+    return add(item, item.source);
+}
+
+ArticleStore::Index ArticleStore::add(const RSSItem& item, std::string_view source) {
+    Article a;
+    a.title = append(item.title);
+    a.link = append(item.link);
+    a.description = append(item.description);
+    a.pubDate = append(item.pubDate);
+    a.imageUrl = append(item.imageUrl);
+    a.source = sources_.intern(source);
+    a.author = authors_.intern(item.author);
+    a.pubTime = item.pubTime;
+    articles_.push_back(a);
+    Index i = static_cast<Index>(articles_.size() - 1);
+    links_[std::hash<std::string_view>{}(item.link)] = i;
+    return i;
+}
+
+ArticleStore::Index ArticleStore::findLink(std::string_view link) const {
+    auto it = links_.find(std::hash<std::string_view>{}(link));
+    if (it == links_.end() || this->link(it->second) != link) return kNoId;
+    return it->second;
+}
+
+void ArticleStore::reserve(size_t articles, size_t textBytes) {
+    articles_.reserve(articles);
+    links_.reserve(articles);
+    arena_.reserve(textBytes);
+}
+
+void ArticleStore::clear() {
+    arena_.clear();
+    articles_.clear();
+    links_.clear();
+    sources_.clear();
+    authors_.clear();
+}
+
+void ArticleStore::setImageUrl(Index i, std::string_view url) {
+    articles_[i].imageUrl = append(url);
+}
+
+RSSItem ArticleStore::item(Index i) const {
+    RSSItem item;
+    item.title = title(i);
+    item.link = link(i);
+    item.description = description(i);
+    item.pubDate = pubDate(i);
+    item.source = source(i);
+    item.imageUrl = imageUrl(i);
+    item.author = author(i);
+    item.pubTime = pubTime(i);
+    return item;
+}
+
+size_t ArticleStore::memoryUsage() const {
+    size_t links = links_.bucket_count() * sizeof(void*) +
+                   links_.size() * (sizeof(size_t) + sizeof(Index) + 2 * sizeof(void*));
+    return arena_.capacity() + articles_.capacity() * sizeof(Article) + links +
+           sources_.memoryUsage() + authors_.memoryUsage();
+}
+
+}
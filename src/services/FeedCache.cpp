@@ -0,0 +1,136 @@
+#include "services/FeedCache.hpp"
+#include "utils/DateParser.hpp"
+#include "utils/DiskCache.hpp"
+
+namespace InfoDash {
+
+// Entries are persisted through DiskCache as length-prefixed fields
+// ("<len>:<bytes>"), format version first, so feeds survive a restart.
+static const char* kFormatVersion = "3";
+
+static void appendField(std::string& out, const std::string& field) {
+    out += std::to_string(field.size());
+    out += ':';
+    out += field;
+}
+
+static bool readField(const std::string& in, size_t& pos, std::string& field) {
+    size_t colon = in.find(':', pos);
+    if (colon == std::string::npos) return false;
+    size_t len = 0;
+    try {
+        len = std::stoul(in.substr(pos, colon - pos));
+    } catch (...) {
+        return false;
+    }
+    if (colon + 1 + len > in.size()) return false;
+    field.assign(in, colon + 1, len);
+    pos = colon + 1 + len;
+    return true;
+}
+
+static std::string serialize(const FeedCache::Entry& entry) {
+    std::string out;
+    appendField(out, kFormatVersion);
+    appendField(out, entry.etag);
+    appendField(out, entry.lastModified);
+    appendField(out, entry.feedUrl);
+    appendField(out, std::to_string(entry.items ? entry.items->size() : 0));
+    if (entry.items) {
+        for (const auto& item : *entry.items) {
+            appendField(out, item.title);
+            appendField(out, item.link);
+            appendField(out, item.description);
+            appendField(out, item.pubDate);
+            appendField(out, item.source);
+            appendField(out, item.imageUrl);
+            appendField(out, item.author);
+            appendField(out, item.guid);
+        }
+    }
+    return out;
+}
+
+static bool deserialize(const std::string& in, FeedCache::Entry& entry) {
+    size_t pos = 0;
+    std::string version, count;
+    if (!readField(in, pos, version) || version != kFormatVersion) return false;
+    if (!readField(in, pos, entry.etag) || !readField(in, pos, entry.lastModified)) return false;
+    if (!readField(in, pos, entry.feedUrl)) return false;
+    if (!readField(in, pos, count)) return false;
+
+    auto items = std::make_shared<std::vector<RSSItem>>();
+    size_t n = 0;
+    try {
+        n = std::stoul(count);
+    } catch (...) {
+        return false;
+    }
+    items->reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        RSSItem item;
+        if (!readField(in, pos, item.title) || !readField(in, pos, item.link) ||
+            !readField(in, pos, item.description) || !readField(in, pos, item.pubDate) ||
+            !readField(in, pos, item.source) || !readField(in, pos, item.imageUrl) ||
+            !readField(in, pos, item.author) || !readField(in, pos, item.guid)) {
+            return false;
+        }
+        item.pubTime = DateParser::parse(item.pubDate);
+        items->push_back(std::move(item));
+    }
+    entry.items = std::move(items);
+    return true;
+}
+
+FeedCache& FeedCache::getInstance() {
+    static FeedCache instance;
+    return instance;
+}
+
+bool FeedCache::lookup(const std::string& url, Entry& entry) const {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(url);
+        if (it != entries_.end()) {
+            entry = it->second;
+            return true;
+        }
+    }
+
+    std::string data;
+    if (!DiskCache::getInstance().get("feed:" + url, data)) return false;
+    Entry loaded;
+    if (!deserialize(data, loaded)) return false;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    // A fetch may have stored a fresher entry while we were reading.
+    auto it = entries_.emplace(url, std::move(loaded)).first;
+    entry = it->second;
+    return true;
+}
+
+void FeedCache::store(const std::string& url, Entry entry) {
+    std::string data = serialize(entry);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_[url] = std::move(entry);
+    }
+    DiskCache::getInstance().put("feed:" + url, data);
+}
+
+void FeedCache::erase(const std::string& url) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.erase(url);
+    }
+    DiskCache::getInstance().remove("feed:" + url);
+}
+
+std::map<std::string, std::string> FeedCache::conditionalHeaders(const Entry& entry) {
+    std::map<std::string, std::string> headers;
+    if (!entry.etag.empty()) headers["If-None-Match"] = entry.etag;
+    if (!entry.lastModified.empty()) headers["If-Modified-Since"] = entry.lastModified;
+    return headers;
+}
+
+}
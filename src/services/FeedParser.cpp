@@ -0,0 +1,231 @@
+#include "services/FeedParser.hpp"
+#include "utils/DateParser.hpp"
+#include "utils/HtmlParser.hpp"
+#include <libxml/parser.h>
+#include <cstring>
+
+namespace InfoDash {
+
+static const char* kAtomNs = "http://www.w3.org/2005/Atom";
+static const char* kContentNs = "http://purl.org/rss/1.0/modules/content/";
+static const char* kMediaNs = "http://search.yahoo.com/mrss/";
+
+// Parse state. Field handling mirrors HtmlParser::parseRSSItems: only direct
+// children of <item>/<entry> are looked at, later fields overwrite earlier
+// ones, and text is the trimmed concatenation of all descendant text.
+struct FeedParser::State {
+    int depth = 0;
+    int itemDepth = 0;          // 0 when not inside an item
+    bool feedRoot = false;
+    bool itemIsAtom = false;
+    RSSItem item;
+    std::string descriptionHtml;
+
+    bool inField = false;
+    std::string fieldName;
+    std::string fieldPrefix;
+    std::string fieldUri;
+    std::string href, type, url;
+    std::string text;
+
+    std::vector<RSSItem> rssItems;
+    std::vector<RSSItem> atomItems;
+    size_t rssDelivered = 0;
+    size_t atomDelivered = 0;
+};
+
+static bool equals(const xmlChar* a, const char* b) {
+    return a && strcmp(reinterpret_cast<const char*>(a), b) == 0;
+}
+
+static std::string str(const xmlChar* s) {
+    return s ? reinterpret_cast<const char*>(s) : "";
+}
+
+static std::string trim(const std::string& s) {
+    size_t start = s.find_first_not_of(" \t\n\r");
+    if (start == std::string::npos) return "";
+    size_t end = s.find_last_not_of(" \t\n\r");
+    return s.substr(start, end - start + 1);
+}
+
+static void onStartElement(void* ctx, const xmlChar* localname, const xmlChar* prefix,
+                           const xmlChar* uri, int, const xmlChar**, int nbAttributes,
+                           int, const xmlChar** attributes) {
+    auto* st = static_cast<FeedParser::State*>(ctx);
+    st->depth++;
+    if (st->depth == 1) {
+        st->feedRoot = equals(localname, "rss") || equals(localname, "RDF") ||
+                       (equals(localname, "feed") && equals(uri, kAtomNs));
+    }
+
+    if (st->itemDepth == 0) {
+        bool atom = equals(localname, "entry") && equals(uri, kAtomNs);
+        if (equals(localname, "item") || atom) {
+            st->itemDepth = st->depth;
+            st->itemIsAtom = atom;
+            st->item = RSSItem();
+            st->descriptionHtml.clear();
+        }
+        return;
+    }
+
+    if (st->depth != st->itemDepth + 1) return;
+
+    st->inField = true;
+    st->fieldName = str(localname);
+    st->fieldPrefix = str(prefix);
+    st->fieldUri = str(uri);
+    st->href.clear();
+    st->type.clear();
+    st->url.clear();
+    st->text.clear();
+
+    // attributes: (localname, prefix, URI, value, end) per attribute
+    for (int i = 0; i < nbAttributes; ++i) {
+        const xmlChar** a = attributes + i * 5;
+        std::string value(reinterpret_cast<const char*>(a[3]), a[4] - a[3]);
+        if (equals(a[0], "href")) st->href = std::move(value);
+        else if (equals(a[0], "type")) st->type = std::move(value);
+        else if (equals(a[0], "url")) st->url = std::move(value);
+    }
+}
+
+static void finishField(FeedParser::State* st) {
+    const std::string& name = st->fieldName;
+    std::string content = trim(st->text);
+    bool contentNs = st->fieldPrefix == "content" || st->fieldUri == kContentNs;
+    bool mediaNs = st->fieldPrefix == "media" || st->fieldUri == kMediaNs;
+    RSSItem& item = st->item;
+
+    if (name == "title") {
+        item.title = content;
+    } else if (name == "link") {
+        if (!st->href.empty()) item.link = st->href;
+        else if (!content.empty()) item.link = content;
+    } else if (name == "description" || name == "summary") {
+        item.description = content;
+        st->descriptionHtml = content;
+    } else if (name == "encoded" && contentNs) {
+        // content:encoded often has full HTML with images
+        st->descriptionHtml = content;
+        if (item.description.empty()) item.description = content;
+    } else if (name == "pubDate" || name == "published" || name == "updated" || name == "date") {
+        item.pubDate = content;
+    } else if (name == "creator" || name == "author") {
+        item.author = content;
+    } else if (name == "guid" || name == "id") {
+        item.guid = content;
+    } else if (name == "enclosure") {
+        if (st->type.find("image") != std::string::npos && !st->url.empty()) item.imageUrl = st->url;
+    } else if ((name == "thumbnail" || name == "content") && mediaNs) {
+        if (!st->url.empty()) item.imageUrl = st->url;
+    } else if (name == "image") {
+        if (!st->href.empty()) item.imageUrl = st->href;
+        else if (!content.empty() && content.find("http") == 0) item.imageUrl = content;
+    }
+}
+
+static void finishItem(FeedParser::State* st) {
+    RSSItem& item = st->item;
+    bool needImage = item.imageUrl.empty() && !st->descriptionHtml.empty();
+    if (!item.description.empty()) {
+        if (needImage && item.description == st->descriptionHtml) {
+            item.description = HtmlParser::htmlToText(item.description, HtmlParser::kDescriptionLimit,
+                                                      &item.imageUrl);
+            needImage = false;
+        } else {
+            item.description = HtmlParser::summarizeDescription(item.description);
+        }
+    }
+    if (needImage) {
+        item.imageUrl = HtmlParser::extractImageFromHtml(st->descriptionHtml);
+    }
+    if (item.title.empty()) return;
+    item.pubTime = DateParser::parse(item.pubDate);
+    (st->itemIsAtom ? st->atomItems : st->rssItems).push_back(std::move(item));
+}
+
+static void onEndElement(void* ctx, const xmlChar*, const xmlChar*, const xmlChar*) {
+    auto* st = static_cast<FeedParser::State*>(ctx);
+    if (st->itemDepth != 0) {
+        if (st->inField && st->depth == st->itemDepth + 1) {
+            finishField(st);
+            st->inField = false;
+        } else if (st->depth == st->itemDepth) {
+            finishItem(st);
+            st->itemDepth = 0;
+        }
+    }
+    st->depth--;
+}
+
+static void onCharacters(void* ctx, const xmlChar* ch, int len) {
+    auto* st = static_cast<FeedParser::State*>(ctx);
+    if (st->inField) st->text.append(reinterpret_cast<const char*>(ch), len);
+}
+
+static xmlSAXHandler makeHandler() {
+    xmlSAXHandler handler;
+    memset(&handler, 0, sizeof(handler));
+    handler.initialized = XML_SAX2_MAGIC;
+    handler.startElementNs = onStartElement;
+    handler.endElementNs = onEndElement;
+    handler.characters = onCharacters;
+    handler.cdataBlock = onCharacters;
+    return handler;
+}
+
+FeedParser::FeedParser() : state_(std::make_unique<State>()), ctxt_(nullptr) {
+    xmlSAXHandler handler = makeHandler();
+    ctxt_ = xmlCreatePushParserCtxt(&handler, state_.get(), nullptr, 0, nullptr);
+    if (ctxt_) xmlCtxtUseOptions(ctxt_, XML_PARSE_NONET | XML_PARSE_NOERROR | XML_PARSE_NOWARNING);
+}
+
+FeedParser::~FeedParser() {
+    if (ctxt_) {
+        if (ctxt_->myDoc) xmlFreeDoc(ctxt_->myDoc);
+        xmlFreeParserCtxt(ctxt_);
+    }
+}
+
+bool FeedParser::feed(const char* data, size_t size) {
+    if (!ctxt_ || !ctxt_->wellFormed) return false;
+    xmlParseChunk(ctxt_, data, static_cast<int>(size), 0);
+    return ctxt_->wellFormed != 0;
+}
+
+bool FeedParser::finish() {
+    if (!ctxt_ || !ctxt_->wellFormed) return false;
+    xmlParseChunk(ctxt_, nullptr, 0, 1);
+    return ctxt_->wellFormed != 0;
+}
+
+// Previews follow whichever kind has items so far; finish()/takeItems()
+// settle the RSS-over-Atom precedence for the final list.
+std::vector<RSSItem> FeedParser::takeNewItems() {
+    bool rss = !state_->rssItems.empty();
+    auto& all = rss ? state_->rssItems : state_->atomItems;
+    size_t& delivered = rss ? state_->rssDelivered : state_->atomDelivered;
+    std::vector<RSSItem> fresh(all.begin() + delivered, all.end());
+    delivered = all.size();
+    return fresh;
+}
+
+std::vector<RSSItem> FeedParser::takeItems() {
+    // Same precedence as the DOM parser: RSS items first, Atom entries otherwise.
+    return state_->rssItems.empty() ? std::move(state_->atomItems) : std::move(state_->rssItems);
+}
+
+bool FeedParser::isFeed() const {
+    return state_->feedRoot;
+}
+
+bool FeedParser::parse(const std::string& xml, std::vector<RSSItem>& items) {
+    FeedParser parser;
+    if (!parser.feed(xml.data(), xml.size()) || !parser.finish()) return false;
+    items = parser.takeItems();
+    return true;
+}
+
+}
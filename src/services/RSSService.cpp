@@ -1,270 +1,494 @@
 #include "services/RSSService.hpp"
 #include "utils/HttpClient.hpp"
+#include "utils/HttpEngine.hpp"
 #include "utils/HtmlParser.hpp"
 #include "utils/Config.hpp"
-#include <thread>
+#include "utils/DateParser.hpp"
+#include "utils/Utf8.hpp"
+#include "services/ArticleArchive.hpp"
+#include "services/ArticleImages.hpp"
+#include "services/FeedCache.hpp"
+#include "services/FeedParser.hpp"
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
-#include <algorithm>
-#include <regex>
+#include <set>
 
 namespace InfoDash {
 
-// Sanitize string to valid UTF-8
-static std::string sanitizeUtf8(const std::string& input) {
-    std::string result;
-    const char* p = input.c_str();
-    while (*p) {
-        unsigned char c = static_cast<unsigned char>(*p);
-        if (c < 0x80) {
-            // ASCII
-            result += *p;
-            p++;
-        } else if ((c & 0xE0) == 0xC0 && p[1]) {
-            // 2-byte UTF-8
-            if ((p[1] & 0xC0) == 0x80) {
-                result += p[0];
-                result += p[1];
-                p += 2;
-            } else {
-                p++; // Skip invalid
+// Recovering DOM parse for documents FeedParser rejects as malformed.
+static std::vector<RSSItem> parseFeedItemsDom(const std::string& body) {
+    std::vector<RSSItem> items;
+    for (const auto& p : HtmlParser::parseRSSItems(body)) {
+        RSSItem item;
+        item.title = p.count("title") ? p.at("title") : "";
+        item.link = p.count("link") ? p.at("link") : "";
+        item.description = p.count("description") ? p.at("description") : "";
+        item.pubDate = p.count("pubDate") ? p.at("pubDate") : "";
+        item.pubTime = DateParser::parse(item.pubDate);
+        item.imageUrl = p.count("imageUrl") ? p.at("imageUrl") : "";
+        item.author = p.count("author") ? p.at("author") : "";
+        item.guid = p.count("guid") ? p.at("guid") : "";
+        items.push_back(std::move(item));
+    }
+    return items;
+}
+
+static std::vector<RSSItem> parseFeedItems(const std::string& body) {
+    std::vector<RSSItem> items;
+    if (FeedParser::parse(body, items)) return items;
+    return parseFeedItemsDom(body);
+}
+
+static std::string sourceFromUrl(const std::string& url) {
+    size_t start = url.find("://");
+    if (start == std::string::npos) return "";
+    start += 3;
+    size_t end = url.find("/", start);
+    return url.substr(start, end - start);
+}
+
+// Parses a feed body while it downloads. Chunks arrive on the engine I/O
+// thread and are queued; a single drain task at a time feeds them to the
+// push parser on a worker, so chunks stay in order and the I/O thread never
+// parses. finish() runs after the last chunk has been parsed.
+struct FeedStream : std::enable_shared_from_this<FeedStream> {
+    // `isFeed`: the document was a feed, whether or not it had items.
+    using Done = std::function<void(bool wellFormed, bool isFeed, std::vector<RSSItem> items)>;
+
+    FeedParser parser;
+    std::function<void(std::vector<RSSItem>)> onItems;  // worker thread
+
+    void push(const char* data, size_t size) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (failed_) return;
+            pending_.append(data, size);
+            if (draining_) return;
+            draining_ = true;
+        }
+        auto self = shared_from_this();
+        HttpEngine::getInstance().post([self]() { self->drain(); });
+    }
+
+    void finish(Done done) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            done_ = std::move(done);
+            if (draining_) return;  // the running drain will pick it up
+            draining_ = true;
+        }
+        drain();
+    }
+
+private:
+    void drain() {
+        for (;;) {
+            std::string chunk;
+            Done done;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (pending_.empty()) {
+                    draining_ = false;
+                    if (!done_) return;
+                    done = std::move(done_);
+                    done_ = nullptr;
+                } else {
+                    chunk.swap(pending_);
+                }
             }
-        } else if ((c & 0xF0) == 0xE0 && p[1] && p[2]) {
-            // 3-byte UTF-8
-            if ((p[1] & 0xC0) == 0x80 && (p[2] & 0xC0) == 0x80) {
-                result += p[0];
-                result += p[1];
-                result += p[2];
-                p += 3;
-            } else {
-                p++;
+            if (done) {
+                bool ok = !failed_ && parser.finish();
+                done(ok, ok && parser.isFeed(), ok ? parser.takeItems() : std::vector<RSSItem>{});
+                return;
             }
-        } else if ((c & 0xF8) == 0xF0 && p[1] && p[2] && p[3]) {
-            // 4-byte UTF-8
-            if ((p[1] & 0xC0) == 0x80 && (p[2] & 0xC0) == 0x80 && (p[3] & 0xC0) == 0x80) {
-                result += p[0];
-                result += p[1];
-                result += p[2];
-                result += p[3];
-                p += 4;
-            } else {
-                p++;
+            if (failed_) continue;
+            if (!parser.feed(chunk.data(), chunk.size())) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                failed_ = true;
+                pending_.clear();
+                continue;
             }
-        } else {
-            p++; // Skip invalid byte
+            auto fresh = parser.takeNewItems();
+            if (!fresh.empty() && onItems) onItems(std::move(fresh));
         }
     }
-    return result;
+
+    std::mutex mutex_;
+    std::string pending_;
+    bool draining_ = false;
+    bool failed_ = false;
+    Done done_;
+};
+
+// The feed a page advertises through <link>, preferring rel="alternate".
+static std::string advertisedFeedLink(const std::string& html) {
+    HtmlParser parser;
+    if (!parser.parse(html)) return "";
+    std::string href = parser.getAttribute("//link[@rel='alternate' and (contains(@type,'rss') or contains(@type,'atom'))]", "href");
+    if (href.empty()) {
+        // fallback: any link element with rss/feed in href
+        href = parser.getAttribute("//link[contains(translate(@href,'RSS','rss'),'rss') or contains(translate(@href,'FEED','feed'),'feed')]", "href");
+    }
+    return href;
 }
 
-RSSService::RSSService() {}
+// Every href in the raw HTML containing "rss" or "feed" (case-insensitive).
+static std::vector<std::string> feedLikeHrefs(const std::string& body) {
+    std::vector<std::string> hrefs;
+    std::string lower = body;
+    std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+    size_t pos = 0;
+    while (pos != std::string::npos) {
+        pos = lower.find("href", pos);
+        if (pos == std::string::npos) break;
+        size_t eq = lower.find('=', pos);
+        if (eq == std::string::npos) { pos += 4; continue; }
+        size_t q = lower.find_first_of("'\"", eq);
+        if (q == std::string::npos) { pos = eq + 1; continue; }
+        size_t endq = body.find(body[q], q + 1);
+        if (endq == std::string::npos) { pos = q + 1; continue; }
+        std::string lowerCand = lower.substr(q + 1, endq - (q + 1));
+        if (lowerCand.find("rss") != std::string::npos || lowerCand.find("feed") != std::string::npos) {
+            hrefs.push_back(body.substr(q + 1, endq - (q + 1)));
+        }
+        pos = endq + 1;
+    }
+    return hrefs;
+}
 
-void RSSService::fetchFeed(const std::string& url, std::function<void(std::vector<RSSItem>)> callback) {
-    std::thread([url, callback]() {
+// Finds the feed behind an HTML page. All candidates (the advertised link,
+// feed-like hrefs, then common paths) are probed at once; the first one that
+// parses wins and the rest are cancelled. A candidate that is itself an HTML
+// index gets one nested probe of the link it advertises. Everything shares
+// one deadline: probe timeouts are clipped to it, and any completion after
+// it ends the search.
+struct FeedDiscovery : std::enable_shared_from_this<FeedDiscovery> {
+    using Done = std::function<void(std::string feedUrl, HttpClient::Response response,
+                                    std::vector<RSSItem> items)>;
+
+    static constexpr auto kBudget = std::chrono::seconds(15);
+    static constexpr size_t kMaxProbes = 16;
+
+    static void run(const std::string& pageUrl, const std::string& html, Done done) {
+        auto self = std::make_shared<FeedDiscovery>();
+        self->done_ = std::move(done);
+        self->deadline_ = std::chrono::steady_clock::now() + kBudget;
+
+        std::vector<std::string> hrefs;
+        std::string advertised = advertisedFeedLink(html);
+        if (!advertised.empty()) hrefs.push_back(advertised);
+        for (auto& href : feedLikeHrefs(html)) hrefs.push_back(std::move(href));
+        for (const char* path : {"/rss", "/feed", "/feeds", "/rss.xml", "/feed.xml", "/feeds.xml",
+                                 "/index.rss", "/feeds/rss.xml", "/services/rss/?no_redirect=true"}) {
+            hrefs.push_back(path);
+        }
+
+        std::vector<std::string> candidates;
+        {
+            std::lock_guard<std::mutex> lock(self->mutex_);
+            for (const auto& href : hrefs) {
+                std::string u = HtmlParser::resolveUrl(pageUrl, href);
+                if (u == pageUrl || !self->tried_.insert(u).second) continue;
+                candidates.push_back(std::move(u));
+                if (candidates.size() == kMaxProbes) break;
+            }
+            self->outstanding_ = candidates.size();
+        }
+        if (candidates.empty()) {
+            self->fail();
+            return;
+        }
+        for (const auto& u : candidates) self->probe(u, false);
+    }
+
+private:
+    void probe(const std::string& u, bool nested) {
+        auto remaining = std::chrono::duration_cast<std::chrono::seconds>(
+            deadline_ - std::chrono::steady_clock::now());
         HttpClient client;
-        auto response = client.get(url);
-        std::vector<RSSItem> items;
-        const size_t MAX_AUTODISCOVER_ITEMS = 20;
-        
-        auto tryParse = [&](const std::string &body) -> std::vector<std::map<std::string, std::string>> {
+        HttpClient::Request request = client.makeRequest(u);
+        request.timeoutSeconds = std::max<long>(1, remaining.count());
+        request.cancelled = cancelled_;
+        auto self = shared_from_this();
+        client.getAsync(std::move(request), [self, u, nested](HttpClient::Response response) {
+            self->onResponse(u, nested, std::move(response));
+        });
+    }
+
+    void onResponse(const std::string& u, bool nested, HttpClient::Response response) {
+        if (!cancelled_->load() && response.success) {
+            std::vector<RSSItem> items;
             try {
-                return HtmlParser::parseRSSItems(body);
+                items = parseFeedItems(response.body);
             } catch (...) {
-                return {};
             }
+            if (!items.empty()) {
+                if (!cancelled_->exchange(true)) done_(u, std::move(response), std::move(items));
+                settle();
+                return;
+            }
+            // An HTML index (like CNN's services/rss): probe the link it advertises.
+            std::string inner = nested ? "" : advertisedFeedLink(response.body);
+            if (!inner.empty() && std::chrono::steady_clock::now() < deadline_) {
+                inner = HtmlParser::resolveUrl(u, inner);
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (tried_.insert(inner).second) {
+                    ++outstanding_;
+                    probe(inner, true);
+                }
+            }
+        }
+        if (std::chrono::steady_clock::now() >= deadline_) fail();
+        settle();
+    }
+
+    // One probe has finished; the last one out reports failure if nothing won.
+    void settle() {
+        bool last = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            last = --outstanding_ == 0;
+        }
+        if (last) fail();
+    }
+
+    void fail() {
+        if (!cancelled_->exchange(true)) done_("", HttpClient::Response{0, "", {}, false, ""}, {});
+    }
+
+    std::shared_ptr<std::atomic<bool>> cancelled_ = std::make_shared<std::atomic<bool>>(false);
+    std::chrono::steady_clock::time_point deadline_;
+    std::mutex mutex_;
+    std::set<std::string> tried_;
+    size_t outstanding_ = 0;
+    Done done_;
+};
+
+// Fills in article images resolved on earlier runs; pages not seen yet are
+// left to RSSService::resolveImages so delivery never waits on them.
+static void applyKnownImages(std::vector<RSSItem>& items) {
+    auto& images = ArticleImages::getInstance();
+    for (auto& item : items) {
+        if (item.imageUrl.empty() && !item.link.empty()) images.lookup(item.link, item.imageUrl);
+    }
+}
+
+// Sanitizes freshly parsed items, caches and delivers them. `feedUrl` is set
+// when the items came from a feed discovered behind `url`; `response` is the
+// one the items were parsed from.
+static void deliverItems(const std::string& url, const std::string& feedUrl,
+                         const HttpClient::Response& response, std::vector<RSSItem> items,
+                         const RSSService::FeedCallback& callback) {
+    const size_t MAX_AUTODISCOVER_ITEMS = 20;
+
+    // If we autodiscovered from a non-feed page, cap number of items
+    if (!feedUrl.empty() && items.size() > MAX_AUTODISCOVER_ITEMS) {
+        items.resize(MAX_AUTODISCOVER_ITEMS);
+    }
+    for (auto& item : items) {
+        item.title = Utf8::sanitize(std::move(item.title));
+        item.description = Utf8::sanitize(std::move(item.description));
+        item.author = Utf8::sanitize(std::move(item.author));
+        item.source = sourceFromUrl(url);
+    }
+
+    if (!items.empty()) {
+        FeedCache::Entry entry;
+        entry.etag = response.header("ETag");
+        entry.lastModified = response.header("Last-Modified");
+        entry.feedUrl = feedUrl;
+        entry.items = std::make_shared<const std::vector<RSSItem>>(items);
+        FeedCache::getInstance().store(url, std::move(entry));
+    }
+    applyKnownImages(items);
+    callback(std::move(items), true);
+}
+
+// Fetches the feed configured as `url` from `fetchUrl`, which is either `url`
+// itself or the feed previously discovered behind it. `headers` carries the
+// validators of the cache entry whose items are `cachedItems`, reused on a
+// 304. Runs on an engine worker.
+static void fetchFeedFrom(const std::string& url, const std::string& fetchUrl,
+                          std::map<std::string, std::string> headers,
+                          std::shared_ptr<const std::vector<RSSItem>> cachedItems,
+                          RSSService::FeedCallback callback,
+                          std::function<void(std::vector<RSSItem>)> onPartial) {
+    auto stream = std::make_shared<FeedStream>();
+    if (onPartial) {
+        stream->onItems = [url, onPartial](std::vector<RSSItem> items) {
+            for (auto& item : items) {
+                item.title = Utf8::sanitize(std::move(item.title));
+                item.description = Utf8::sanitize(std::move(item.description));
+                item.author = Utf8::sanitize(std::move(item.author));
+                item.source = sourceFromUrl(url);
+            }
+            onPartial(std::move(items));
         };
+    }
+
+    auto handleResponse = [url, fetchUrl, cachedItems, callback, onPartial](HttpClient::Response response,
+                                                                            bool streamed, bool isFeed,
+                                                                            std::vector<RSSItem> streamedItems) {
+        const std::string feedUrl = fetchUrl == url ? "" : fetchUrl;
+
+        // Unchanged since the last fetch: reuse the items parsed then.
+        if (response.statusCode == 304 && cachedItems) {
+            std::vector<RSSItem> items = *cachedItems;
+            applyKnownImages(items);
+            callback(std::move(items), true);
+            return;
+        }
 
         if (response.success) {
-            auto parsed = HtmlParser::parseRSSItems(response.body);
-            bool autodiscovered = false;
-            // If no items found, try autodiscovering an RSS/Atom link from HTML
-            if (parsed.empty()) {
-                autodiscovered = true;
-                HtmlParser parser;
-                if (parser.parse(response.body)) {
-                    // Try <link rel="alternate" type="application/rss+xml|atom" href="...">
-                    std::string href = parser.getAttribute("//link[@rel='alternate' and (contains(@type,'rss') or contains(@type,'atom'))]", "href");
-                    if (href.empty()) {
-                        // fallback: any link element with rss/feed in href
-                        href = parser.getAttribute("//link[contains(translate(@href,'RSS','rss'),'rss') or contains(translate(@href,'FEED','feed'),'feed')]", "href");
-                    }
-
-                    auto resolveUrl = [](const std::string &base, const std::string &href) {
-                        if (href.rfind("http://", 0) == 0 || href.rfind("https://", 0) == 0) return href;
-                        size_t s = base.find("://");
-                        std::string scheme = "https";
-                        std::string host = base;
-                        if (s != std::string::npos) {
-                            scheme = base.substr(0, s);
-                            size_t start = s + 3;
-                            size_t end = base.find('/', start);
-                            host = (end == std::string::npos) ? base.substr(start) : base.substr(start, end - start);
-                        }
-                        if (href.rfind("//", 0) == 0) return scheme + ":" + href;
-                        if (href.rfind("/", 0) == 0) return scheme + "://" + host + href;
-                        size_t pos = base.rfind('/');
-                        std::string basepath = (pos == std::string::npos) ? base : base.substr(0, pos + 1);
-                        return basepath + href;
-                    };
-
-                    auto tryFeedUrl = [&](const std::string &candidate) -> bool {
-                        std::string u = resolveUrl(url, candidate);
-                        auto r = client.get(u);
-                        if (r.success) {
-                            auto parsed2 = tryParse(r.body);
-                            if (!parsed2.empty()) { parsed = parsed2; return true; }
-
-                            // If the candidate returned an HTML index (like CNN's services/rss),
-                            // look for link elements inside that page and probe them.
-                            HtmlParser subparser;
-                            if (subparser.parse(r.body)) {
-                                std::string found = subparser.getAttribute("//link[@rel='alternate' and (contains(@type,'rss') or contains(@type,'atom'))]", "href");
-                                if (found.empty()) {
-                                    found = subparser.getAttribute("//link[contains(translate(@href,'RSS','rss'),'rss') or contains(translate(@href,'FEED','feed'),'feed')]", "href");
-                                }
-                                if (!found.empty()) {
-                                    std::string inner = resolveUrl(u, found);
-                                    auto r2 = client.get(inner);
-                                    if (r2.success) {
-                                        auto parsed3 = tryParse(r2.body);
-                                        if (!parsed3.empty()) { parsed = parsed3; return true; }
-                                    }
-                                }
-                            }
-                        }
-                        return false;
-                    };
-
-                    // If a link was found, try it first
-                    if (!href.empty()) {
-                        if (tryFeedUrl(href)) {
-                            // found, parsed now set
-                        }
-                    }
-
-                    // If still empty, try scanning raw HTML for RSS-like hrefs
-                    if (parsed.empty()) {
-                        // Scan raw HTML for hrefs containing 'rss' or 'feed' (case-insensitive)
-                        std::string body = response.body;
-                        std::string lower = body;
-                        std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
-                        size_t pos = 0;
-                        while (pos != std::string::npos) {
-                            pos = lower.find("href", pos);
-                            if (pos == std::string::npos) break;
-                            // find '=' after href
-                            size_t eq = lower.find('=', pos);
-                            if (eq == std::string::npos) { pos += 4; continue; }
-                            // find opening quote
-                            size_t q = lower.find_first_of("'\"", eq);
-                            if (q == std::string::npos) { pos = eq + 1; continue; }
-                            char quote = body[q];
-                            size_t endq = body.find(quote, q + 1);
-                            if (endq == std::string::npos) { pos = q + 1; continue; }
-                            std::string candidate = body.substr(q + 1, endq - (q + 1));
-                            std::string lowerCand = candidate;
-                            std::transform(lowerCand.begin(), lowerCand.end(), lowerCand.begin(), ::tolower);
-                            if (lowerCand.find("rss") != std::string::npos || lowerCand.find("feed") != std::string::npos) {
-                                if (tryFeedUrl(candidate)) break;
-                            }
-                            pos = endq + 1;
-                        }
-                    }
-
-                    // Still empty: probe common candidate feed paths
-                    if (parsed.empty()) {
-                        std::vector<std::string> candidates = {
-                            "/rss", "/feed", "/feeds", "/rss.xml", "/feed.xml", "/feeds.xml",
-                            "/index.rss", "/feeds/rss.xml", "/services/rss/?no_redirect=true"
-                        };
-                        for (const auto &c : candidates) {
-                            if (tryFeedUrl(c)) break;
-                        }
-                    }
-                    }
-                }
-            // If we autodiscovered from a non-feed page, cap number of items
-            if (!parsed.empty() && autodiscovered && parsed.size() > MAX_AUTODISCOVER_ITEMS) {
-                parsed.resize(MAX_AUTODISCOVER_ITEMS);
+            auto parsed = streamed ? std::move(streamedItems) : parseFeedItemsDom(response.body);
+            if (!parsed.empty()) {
+                deliverItems(url, feedUrl, response, std::move(parsed), callback);
+                return;
             }
-            for (const auto& p : parsed) {
-                RSSItem item;
-                item.title = sanitizeUtf8(p.count("title") ? p.at("title") : "");
-                item.link = p.count("link") ? p.at("link") : "";
-                item.description = sanitizeUtf8(p.count("description") ? p.at("description") : "");
-                item.pubDate = p.count("pubDate") ? p.at("pubDate") : "";
-                item.imageUrl = p.count("imageUrl") ? p.at("imageUrl") : "";
-                item.author = sanitizeUtf8(p.count("author") ? p.at("author") : "");
-                
-                // Extract source from URL
-                size_t start = url.find("://");
-                if (start != std::string::npos) {
-                    start += 3;
-                    size_t end = url.find("/", start);
-                    item.source = url.substr(start, end - start);
-                }
-                // If no image was found in the feed entry, try fetching the article
-                // page and look for OpenGraph/Twitter meta tags or a main image.
-                if (item.imageUrl.empty() && !item.link.empty()) {
-                    auto artResp = client.get(item.link);
-                    if (artResp.success && !artResp.body.empty()) {
-                        HtmlParser artParser;
-                        if (artParser.parse(artResp.body)) {
-                            std::string img = artParser.getAttribute("//meta[@property='og:image']", "content");
-                            if (img.empty()) img = artParser.getAttribute("//meta[@name='twitter:image']", "content");
-                            if (img.empty()) img = artParser.getAttribute("//link[@rel='image_src']", "href");
-                            if (img.empty()) img = artParser.getAttribute("//img[1]", "src");
-                            if (!img.empty()) {
-                                // resolve relative URLs
-                                auto resolveRel = [](const std::string &base, const std::string &href){
-                                    if (href.rfind("http://",0) == 0 || href.rfind("https://",0) == 0) return href;
-                                    size_t s = base.find("://");
-                                    std::string scheme = "https";
-                                    std::string host = base;
-                                    if (s != std::string::npos) {
-                                        scheme = base.substr(0, s);
-                                        size_t start = s + 3;
-                                        size_t end = base.find('/', start);
-                                        host = (end == std::string::npos) ? base.substr(start) : base.substr(start, end - start);
-                                    }
-                                    if (href.rfind("//",0) == 0) return scheme + ":" + href;
-                                    if (href.rfind("/",0) == 0) return scheme + "://" + host + href;
-                                    size_t pos = base.rfind('/');
-                                    std::string basepath = (pos == std::string::npos) ? base : base.substr(0, pos + 1);
-                                    return basepath + href;
-                                };
-                                item.imageUrl = resolveRel(item.link, img);
-                            }
-                        }
-                    }
-                }
-                items.push_back(item);
+            // A feed with nothing in it right now is still a feed.
+            if (isFeed) {
+                callback({}, true);
+                return;
+            }
+        }
+
+        // The remembered feed went away: rediscover from the page.
+        if (!feedUrl.empty()) {
+            fetchFeedFrom(url, url, {}, nullptr, callback, onPartial);
+            return;
+        }
+        if (!response.success) {
+            callback({}, false);
+            return;
+        }
+
+        // No items: the URL is probably a web page; look for its feed.
+        FeedDiscovery::run(url, response.body, [url, callback](std::string found, HttpClient::Response feedResponse,
+                                                               std::vector<RSSItem> items) {
+            if (items.empty()) {
+                callback({}, false);
+                return;
             }
+            deliverItems(url, found, feedResponse, std::move(items), callback);
+        });
+    };
+
+    HttpClient client;
+    HttpClient::Request request = client.makeRequest(fetchUrl);
+    request.headers = std::move(headers);
+    request.onData = [stream](const char* data, size_t size) { stream->push(data, size); };
+    client.getAsync(std::move(request), [stream, handleResponse](HttpClient::Response response) {
+        stream->finish([handleResponse, response = std::move(response)](bool wellFormed, bool isFeed,
+                                                                      std::vector<RSSItem> items) {
+            handleResponse(response, wellFormed, isFeed, std::move(items));
+        });
+    });
+}
+
+RSSService::RSSService() {}
+
+// Feeds autodiscovered on an earlier run are fetched directly. The cache
+// lookup may reach the disk, so it runs on an engine worker, once per fetch.
+void RSSService::fetchFeed(const std::string& url, FeedCallback callback,
+                           std::function<void(std::vector<RSSItem>)> onPartial) {
+    HttpEngine::getInstance().post([url, callback = std::move(callback), onPartial = std::move(onPartial)]() {
+        FeedCache::Entry cached;
+        if (!FeedCache::getInstance().lookup(url, cached)) {
+            fetchFeedFrom(url, url, {}, nullptr, callback, onPartial);
+            return;
+        }
+        std::string fetchUrl = cached.feedUrl.empty() ? url : cached.feedUrl;
+        fetchFeedFrom(url, fetchUrl, FeedCache::conditionalHeaders(cached), cached.items, callback, onPartial);
+    });
+}
+
+void RSSService::loadCachedFeed(const std::string& url, std::function<void(std::vector<RSSItem>)> callback) {
+    HttpEngine::getInstance().post([url, callback]() {
+        std::vector<RSSItem> items = ArticleArchive::getInstance().feedItems(url);
+        FeedCache::Entry entry;
+        if (items.empty() && FeedCache::getInstance().lookup(url, entry) && entry.items) {
+            items = *entry.items;
+        }
+        applyKnownImages(items);
+        callback(std::move(items));
+    });
+}
+
+void RSSService::resolveImages(const std::vector<std::string>& links,
+                               std::function<void(std::string link, std::string imageUrl)> onImage) {
+    if (links.empty()) return;
+    ArticleImages::getInstance().resolve(links, std::move(onImage));
+}
+
+std::vector<RSSItem> RSSService::mergeByDate(std::vector<std::vector<RSSItem>> lists,
+                                             std::vector<uint32_t>* origin) {
+    auto newer = [](const RSSItem& a, const RSSItem& b) { return a.pubTime > b.pubTime; };
+    size_t total = 0;
+    for (auto& list : lists) {
+        // Feeds are nearly always newest-first already; this is then one pass.
+        if (!std::is_sorted(list.begin(), list.end(), newer)) {
+            std::stable_sort(list.begin(), list.end(), newer);
+        }
+        total += list.size();
+    }
+
+    // Heap of list heads, newest on top; ties go to the earlier list.
+    struct Head {
+        int64_t time;
+        size_t list;
+        size_t pos;
+    };
+    auto after = [](const Head& a, const Head& b) {
+        return a.time != b.time ? a.time < b.time : a.list > b.list;
+    };
+    std::vector<Head> heap;
+    heap.reserve(lists.size());
+    for (size_t i = 0; i < lists.size(); ++i) {
+        if (!lists[i].empty()) heap.push_back({lists[i][0].pubTime, i, 0});
+    }
+    std::make_heap(heap.begin(), heap.end(), after);
+
+    std::vector<RSSItem> merged;
+    merged.reserve(total);
+    if (origin) {
+        origin->clear();
+        origin->reserve(total);
+    }
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), after);
+        Head& head = heap.back();
+        auto& list = lists[head.list];
+        merged.push_back(std::move(list[head.pos]));
+        if (origin) origin->push_back(static_cast<uint32_t>(head.list));
+        if (++head.pos < list.size()) {
+            head.time = list[head.pos].pubTime;
+            std::push_heap(heap.begin(), heap.end(), after);
+        } else {
+            heap.pop_back();
         }
-        callback(items);
-    }).detach();
+    }
+    return merged;
 }
 
 void RSSService::fetchAllFeeds(std::function<void(std::vector<RSSItem>)> callback) {
     auto feeds = Config::getInstance().getRSSFeeds();
-    auto results = std::make_shared<std::vector<RSSItem>>();
+    auto results = std::make_shared<std::vector<std::vector<RSSItem>>>(feeds.size());
     auto remaining = std::make_shared<int>(feeds.size());
     auto mtx = std::make_shared<std::mutex>();
 
     if (feeds.empty()) { callback({}); return; }
 
-    for (const auto& feed : feeds) {
-        fetchFeed(feed, [results, remaining, mtx, callback](std::vector<RSSItem> items) {
-            std::lock_guard<std::mutex> lock(*mtx);
-            results->insert(results->end(), items.begin(), items.end());
-            (*remaining)--;
-            if (*remaining == 0) {
-                std::sort(results->begin(), results->end(), [](const RSSItem& a, const RSSItem& b) {
-                    return a.pubDate > b.pubDate;
-                });
-                callback(*results);
+    for (size_t i = 0; i < feeds.size(); ++i) {
+        fetchFeed(feeds[i], [i, results, remaining, mtx, callback](std::vector<RSSItem> items, bool) {
+            {
+                std::lock_guard<std::mutex> lock(*mtx);
+                (*results)[i] = std::move(items);
+                if (--(*remaining) != 0) return;
             }
+            callback(mergeByDate(std::move(*results)));
         });
     }
 }
@@ -0,0 +1,325 @@
+#include "services/SearchIndex.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <numeric>
+
+namespace InfoDash {
+
+static constexpr size_t kMaxWord = 32;       // longer runs are hashes, URLs, base64
+static constexpr size_t kMaxQueryWords = 16;
+static constexpr size_t kMaxRanks = 4096;    // distinct scores ordered by counting
+static constexpr uint16_t kTitleWeight = 4;
+static constexpr uint16_t kAuthorWeight = 2;
+static constexpr uint16_t kTextWeight = 1;
+
+static bool isWordByte(unsigned char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c >= 0x80;
+}
+
+// Calls fn(word) for every word of `text` of at least `minLength` bytes.
+// With `html`, tags and character references are skipped.
+template <typename Fn>
+static void forEachWord(std::string_view text, bool html, size_t minLength, Fn&& fn) {
+    char word[kMaxWord];
+    size_t length = 0;
+    bool tooLong = false;
+    auto flush = [&]() {
+        if (!tooLong && length >= minLength) fn(std::string_view(word, length));
+        length = 0;
+        tooLong = false;
+    };
+
+    for (size_t i = 0; i < text.size(); ++i) {
+        unsigned char c = static_cast<unsigned char>(text[i]);
+        if (isWordByte(c)) {
+            if (length == kMaxWord) {
+                tooLong = true;
+            } else {
+                word[length++] = static_cast<char>(c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c);
+            }
+            continue;
+        }
+        flush();
+        if (!html) continue;
+        if (c == '<') {
+            size_t end = text.find('>', i);
+            if (end == std::string_view::npos) return;
+            i = end;
+        } else if (c == '&') {
+            size_t end = text.find(';', i);
+            if (end != std::string_view::npos && end - i <= 10) i = end;
+        }
+    }
+    flush();
+}
+
+// Sort key for a score, ascending for better matches. Scores are positive,
+// so their float bits order like the values; the top 16 bits (bfloat16,
+// about 3 significant digits) are plenty for ranking.
+static uint16_t rankKey(float score) {
+    uint32_t bits;
+    std::memcpy(&bits, &score, sizeof(bits));
+    return static_cast<uint16_t>(~(bits >> 16));
+}
+
+// Stable two-pass radix sort of `docs` by `ranks`. A broad query can rank
+// every article, and comparison sorting 50k of them takes milliseconds.
+// `docsOut` and `ranksOut` are scratch space, kept by the caller so a
+// search does not fault in fresh pages for them.
+static void sortByRank(std::vector<SearchIndex::DocId>& docs, std::vector<uint16_t>& ranks,
+                       std::vector<SearchIndex::DocId>& docsOut, std::vector<uint16_t>& ranksOut) {
+    docsOut.resize(docs.size());
+    ranksOut.resize(ranks.size());
+    for (int shift = 0; shift < 16; shift += 8) {
+        size_t count[256] = {};
+        for (uint16_t r : ranks) ++count[(r >> shift) & 0xff];
+        if (ranks.empty() || count[(ranks[0] >> shift) & 0xff] == ranks.size()) continue;
+        size_t pos = 0;
+        for (size_t& c : count) {
+            size_t n = c;
+            c = pos;
+            pos += n;
+        }
+        for (size_t i = 0; i < ranks.size(); ++i) {
+            size_t to = count[(ranks[i] >> shift) & 0xff]++;
+            docsOut[to] = docs[i];
+            ranksOut[to] = ranks[i];
+        }
+        docs.swap(docsOut);
+        ranks.swap(ranksOut);
+    }
+}
+
+uint32_t SearchIndex::termId(std::string_view term) {
+    auto it = termIds_.find(term);
+    if (it != termIds_.end()) return it->second;
+    uint32_t id = static_cast<uint32_t>(terms_.size());
+    terms_.emplace_back(term);
+    termIds_.emplace(terms_.back(), id);
+    postings_.emplace_back();
+    return id;
+}
+
+void SearchIndex::addField(DocId doc, std::string_view text, uint16_t weight, bool html) {
+    forEachWord(text, html, 2, [&](std::string_view word) {
+        auto& list = postings_[termId(word)];
+        if (!list.empty() && list.back().doc == doc) {
+            list.back().weight = static_cast<uint16_t>(std::min<uint32_t>(list.back().weight + weight, UINT16_MAX));
+        } else {
+            list.push_back({doc, weight});
+        }
+    });
+}
+
+void SearchIndex::add(DocId doc, std::string_view title, std::string_view description, std::string_view author) {
+    addField(doc, title, kTitleWeight, true);
+    addField(doc, author, kAuthorWeight, false);
+    addField(doc, description, kTextWeight, true);
+    if (doc < docLimit_) ordered_ = false;
+    ++documents_;
+    docLimit_ = std::max(docLimit_, doc + 1);
+}
+
+void SearchIndex::clear() {
+    termIds_.clear();
+    terms_.clear();
+    postings_.clear();
+    sorted_.clear();
+    matched_.clear();
+    score_.clear();
+    ordered_ = true;
+    documents_ = 0;
+    docLimit_ = 0;
+}
+
+// Words added since the last search are sorted on their own and merged in.
+void SearchIndex::prepare() const {
+    size_t old = sorted_.size();
+    if (old == terms_.size()) return;
+    for (size_t id = old; id < terms_.size(); ++id) sorted_.push_back(static_cast<uint32_t>(id));
+    auto byWord = [this](uint32_t a, uint32_t b) { return terms_[a] < terms_[b]; };
+    std::sort(sorted_.begin() + static_cast<std::ptrdiff_t>(old), sorted_.end(), byWord);
+    std::inplace_merge(sorted_.begin(), sorted_.begin() + static_cast<std::ptrdiff_t>(old), sorted_.end(), byWord);
+}
+
+std::vector<SearchIndex::DocId> SearchIndex::search(std::string_view query, size_t limit) const {
+    struct Word {
+        std::string text;
+        std::vector<uint32_t> terms;  // every indexed word it is a prefix of
+        size_t postings = 0;
+    };
+    std::vector<Word> words;
+    forEachWord(query, false, 1, [&](std::string_view w) {
+        if (words.size() == kMaxQueryWords) return;
+        for (const auto& seen : words) {
+            if (seen.text == w) return;
+        }
+        words.push_back({std::string(w), {}, 0});
+    });
+    if (words.empty() || limit == 0) return {};
+
+    prepare();
+    for (auto& word : words) {
+        auto it = std::lower_bound(sorted_.begin(), sorted_.end(), word.text,
+                                   [this](uint32_t id, const std::string& w) { return terms_[id] < w; });
+        for (; it != sorted_.end() && terms_[*it].compare(0, word.text.size(), word.text) == 0; ++it) {
+            word.terms.push_back(*it);
+            word.postings += postings_[*it].size();
+        }
+        if (word.terms.empty()) return {};
+    }
+    // Most selective word first: later words only re-score its matches.
+    std::sort(words.begin(), words.end(), [](const Word& a, const Word& b) { return a.postings < b.postings; });
+
+    auto& hits = candidates_;
+    hits.clear();
+    ranks_.clear();
+    double n = static_cast<double>(documents_);
+    auto idfOf = [&](const Word& word, uint32_t id) {
+        float idf = static_cast<float>(std::log(1.0 + n / static_cast<double>(postings_[id].size())));
+        return terms_[id].size() == word.text.size() ? idf : idf * 0.5f;
+    };
+
+    // One whole word: its posting list is the answer, already in document
+    // order if documents were added in order.
+    if (words.size() == 1 && words[0].terms.size() == 1 && ordered_) {
+        float idf = idfOf(words[0], words[0].terms[0]);
+        for (const Posting& p : postings_[words[0].terms[0]]) {
+            hits.push_back(p.doc);
+            ranks_.push_back(rankKey(idf * static_cast<float>(p.weight)));
+        }
+        return rankedHits(limit);
+    }
+
+    // matched[doc] counts the query words found so far in doc. The first
+    // word's matches are the candidates; later words only score those. The
+    // scratch arrays are all zero again when the search returns.
+    if (matched_.size() < docLimit_) {
+        matched_.resize(docLimit_, 0);
+        score_.resize(docLimit_, 0.0f);
+    }
+    // Plain pointers: stores through uint8_t may alias anything, so
+    // through the vectors every store would reload their data pointers.
+    uint8_t* matched = matched_.data();
+    float* score = score_.data();
+    for (size_t k = 0; k < words.size(); ++k) {
+        auto round = static_cast<uint8_t>(k);
+        for (uint32_t id : words[k].terms) {
+            float idf = idfOf(words[k], id);
+            const Posting* p = postings_[id].data();
+            const Posting* end = p + postings_[id].size();
+            if (k == 0) {
+                for (; p != end; ++p) {
+                    if (matched[p->doc] == 0) {
+                        matched[p->doc] = 1;
+                        hits.push_back(p->doc);
+                    }
+                    score[p->doc] += idf * static_cast<float>(p->weight);
+                }
+                continue;
+            }
+            // matched is round for a live candidate, round + 1 once this
+            // word was seen in it, and less for the rest. For a broad word
+            // which one is a coin toss, so there are no branches here: a
+            // mispredicted one per posting costs more than all of the rest.
+            for (; p != end; ++p) {
+                DocId doc = p->doc;
+                uint8_t m = matched[doc];
+                matched[doc] = static_cast<uint8_t>(m + (m == round));
+                uint32_t weight = p->weight & (0u - static_cast<uint32_t>(m >= round));
+                score[doc] += idf * static_cast<float>(weight);
+            }
+        }
+    }
+
+    // Ties keep document order. One posting list is already in it when
+    // documents were added in order; several interleave. Every candidate
+    // has a nonzero count.
+    if (!(ordered_ && words[0].terms.size() == 1) && !std::is_sorted(hits.begin(), hits.end())) {
+        if (hits.size() > docLimit_ / 16) {
+            size_t i = 0;
+            for (DocId doc = 0; doc < docLimit_; ++doc) {
+                if (matched[doc] != 0) hits[i++] = doc;
+            }
+        } else {
+            std::sort(hits.begin(), hits.end());
+        }
+    }
+
+    // Candidates that every word matched are the hits.
+    auto all = static_cast<uint8_t>(words.size());
+    size_t found = 0;
+    for (DocId doc : hits) {
+        bool hit = matched[doc] == all;
+        uint16_t rank = rankKey(score[doc]);
+        matched[doc] = 0;
+        score[doc] = 0.0f;
+        if (!hit) continue;
+        hits[found++] = doc;
+        ranks_.push_back(rank);
+    }
+    hits.resize(found);
+    return rankedHits(limit);
+}
+
+// Scores are sums of a few small weights, so a broad query usually has only
+// a handful of distinct ranks: count them and place every hit in one pass.
+// Past kMaxRanks distinct ones the radix sort takes over.
+std::vector<SearchIndex::DocId> SearchIndex::rankedHits(size_t limit) const {
+    auto& hits = candidates_;
+    if (rankSlot_.empty()) rankSlot_.assign(size_t(UINT16_MAX) + 1, 0);
+    uint16_t* slots = rankSlot_.data();
+    distinct_.clear();
+    for (uint16_t rank : ranks_) {
+        uint16_t& slot = slots[rank];
+        if (slot == 0) {
+            if (distinct_.size() == kMaxRanks) break;
+            distinct_.push_back({rank, 0});
+            slot = static_cast<uint16_t>(distinct_.size());
+        }
+        ++distinct_[slot - 1].count;
+    }
+    if (distinct_.size() == kMaxRanks) {
+        for (const auto& d : distinct_) slots[d.rank] = 0;
+        sortByRank(hits, ranks_, docsOut_, ranksOut_);
+        return std::vector<DocId>(hits.begin(), hits.begin() + static_cast<std::ptrdiff_t>(std::min(limit, hits.size())));
+    }
+
+    // distinct_[i].count becomes where the next hit of that rank goes.
+    std::vector<uint16_t> order(distinct_.size());
+    std::iota(order.begin(), order.end(), uint16_t(0));
+    std::sort(order.begin(), order.end(), [this](uint16_t a, uint16_t b) { return distinct_[a].rank < distinct_[b].rank; });
+    size_t pos = 0;
+    for (uint16_t i : order) {
+        size_t count = distinct_[i].count;
+        distinct_[i].count = pos;
+        pos += count;
+    }
+    std::vector<DocId> result(std::min(limit, hits.size()));
+    for (size_t i = 0; i < hits.size(); ++i) {
+        size_t to = distinct_[slots[ranks_[i]] - 1].count++;
+        if (to < result.size()) result[to] = hits[i];
+    }
+    for (const auto& d : distinct_) slots[d.rank] = 0;
+    return result;
+}
+
+size_t SearchIndex::memoryUsage() const {
+    size_t bytes = termIds_.bucket_count() * sizeof(void*) +
+                   termIds_.size() * (sizeof(std::string_view) + sizeof(uint32_t) + 2 * sizeof(void*)) +
+                   postings_.capacity() * sizeof(std::vector<Posting>) + sorted_.capacity() * sizeof(uint32_t) +
+                   matched_.capacity() * sizeof(uint8_t) + score_.capacity() * sizeof(float) +
+                   (candidates_.capacity() + docsOut_.capacity()) * sizeof(DocId) +
+                   (ranks_.capacity() + ranksOut_.capacity() + rankSlot_.capacity()) * sizeof(uint16_t) +
+                   distinct_.capacity() * sizeof(RankCount);
+    for (const auto& term : terms_) {
+        bytes += sizeof(std::string);
+        if (term.capacity() > std::string().capacity()) bytes += term.capacity() + 1;
+    }
+    for (const auto& list : postings_) bytes += list.capacity() * sizeof(Posting);
+    return bytes;
+}
+
+}
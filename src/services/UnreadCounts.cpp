@@ -0,0 +1,65 @@
+#include "services/UnreadCounts.hpp"
+
+namespace InfoDash {
+
+void UnreadCounts::rebuild(const ArticleStore& store, const std::vector<ArticleStore::Index>& articles,
+                           const Config& config) {
+    bySource_.assign(store.sourceCount(), 0);
+    total_ = 0;
+    saved_ = 0;
+    const auto& savedArticles = config.getSavedArticles();
+    for (ArticleStore::Index i : articles) {
+        std::string_view link = store.link(i);
+        if (!config.isArticleRead(link)) {
+            ++bySource_[store.sourceId(i)];
+            ++total_;
+        }
+        if (!savedArticles.empty() && savedArticles.count(std::string(link))) ++saved_;
+    }
+}
+
+// Category totals are sums over sources, so they are redone here rather
+// than in rebuild(): this also picks up feeds moved or toggled since.
+void UnreadCounts::assignCategories(const ArticleStore& store, const std::vector<FeedInfo>& feeds) {
+    byCategory_.clear();
+    sourceCategory_.assign(bySource_.size(), nullptr);
+    for (const auto& f : feeds) {
+        if (!f.enabled) continue;
+        auto [it, inserted] = byCategory_.try_emplace(f.category, 0);
+        uint32_t source = store.findSource(f.name);
+        if (source >= bySource_.size() || sourceCategory_[source]) continue;
+        sourceCategory_[source] = &it->first;
+        it->second += bySource_[source];
+    }
+}
+
+void UnreadCounts::clear() {
+    bySource_.clear();
+    sourceCategory_.clear();
+    byCategory_.clear();
+    total_ = 0;
+    saved_ = 0;
+}
+
+void UnreadCounts::setRead(const ArticleStore& store, ArticleStore::Index i, bool read) {
+    int delta = read ? -1 : 1;
+    uint32_t source = store.sourceId(i);
+    total_ += delta;
+    if (source < bySource_.size()) bySource_[source] += delta;
+    if (const std::string* cat = categoryOf(source)) byCategory_[*cat] += delta;
+}
+
+int UnreadCounts::source(uint32_t sourceId) const {
+    return sourceId < bySource_.size() ? bySource_[sourceId] : 0;
+}
+
+int UnreadCounts::category(const std::string& categoryId) const {
+    auto it = byCategory_.find(categoryId);
+    return it != byCategory_.end() ? it->second : 0;
+}
+
+const std::string* UnreadCounts::categoryOf(uint32_t sourceId) const {
+    return sourceId < sourceCategory_.size() ? sourceCategory_[sourceId] : nullptr;
+}
+
+}
@@ -1,8 +1,9 @@
 #include "services/WeatherService.hpp"
 #include "utils/HttpClient.hpp"
 #include "utils/Config.hpp"
+#include "utils/Utf8.hpp"
+#include "utils/HttpEngine.hpp"
 #include <json-glib/json-glib.h>
-#include <thread>
 #include <regex>
 #include <cmath>
 #include <mutex>
@@ -31,55 +32,10 @@ static std::string formatTemp(const std::string& celsius, TempUnit unit) {
     return celsius + "C";
 }
 
-// Sanitize string to valid UTF-8
-static std::string sanitizeUtf8(const char* str) {
-    if (!str) return "";
-    
-    std::string result;
-    const char* p = str;
-    while (*p) {
-        unsigned char c = static_cast<unsigned char>(*p);
-        if (c < 0x80) {
-            result += *p;
-            p++;
-        } else if ((c & 0xE0) == 0xC0 && p[1]) {
-            if ((p[1] & 0xC0) == 0x80) {
-                result += p[0];
-                result += p[1];
-                p += 2;
-            } else {
-                p++;
-            }
-        } else if ((c & 0xF0) == 0xE0 && p[1] && p[2]) {
-            if ((p[1] & 0xC0) == 0x80 && (p[2] & 0xC0) == 0x80) {
-                result += p[0];
-                result += p[1];
-                result += p[2];
-                p += 3;
-            } else {
-                p++;
-            }
-        } else if ((c & 0xF8) == 0xF0 && p[1] && p[2] && p[3]) {
-            if ((p[1] & 0xC0) == 0x80 && (p[2] & 0xC0) == 0x80 && (p[3] & 0xC0) == 0x80) {
-                result += p[0];
-                result += p[1];
-                result += p[2];
-                result += p[3];
-                p += 4;
-            } else {
-                p++;
-            }
-        } else {
-            p++;
-        }
-    }
-    return result;
-}
-
 static std::string safeGetString(JsonObject* obj, const char* member) {
     if (!json_object_has_member(obj, member)) return "";
     const char* val = json_object_get_string_member(obj, member);
-    return sanitizeUtf8(val);
+    return val ? Utf8::sanitize(val) : "";
 }
 
 // URL-encode a string for use in URLs
@@ -134,193 +90,202 @@ std::string WeatherService::getWeatherIcon(const std::string& conditionCode) {
     return "weather-few-clouds-symbolic";
 }
 
-void WeatherService::fetchWeather(const std::string& zipCode, std::function<void(WeatherData)> callback) {
-    std::thread([zipCode, callback]() {
-        WeatherData data;
-        data.zipCode = zipCode;
-        HttpClient client;
-        TempUnit unit = Config::getInstance().getTempUnit();
-        
-        // URL-encode the location for the API request
-        std::string encodedLocation = urlEncode(zipCode);
-        
-        // Fetch JSON format from wttr.in
-        std::string url = "https://wttr.in/" + encodedLocation + "?format=j1";
-        auto response = client.get(url);
-        
-        if (response.success && !response.body.empty()) {
-            JsonParser* parser = json_parser_new();
-            GError* error = nullptr;
+// Parse a wttr.in ?format=j1 response into `data`. Leaves data.temperature
+// empty if the body is not usable.
+static void parseWeatherJson(const std::string& body, TempUnit unit, WeatherData& data) {
+    JsonParser* parser = json_parser_new();
+    GError* error = nullptr;
+    
+    if (json_parser_load_from_data(parser, body.c_str(), -1, &error)) {
+        JsonNode* root = json_parser_get_root(parser);
+        if (root && JSON_NODE_HOLDS_OBJECT(root)) {
+            JsonObject* obj = json_node_get_object(root);
             
-            if (json_parser_load_from_data(parser, response.body.c_str(), -1, &error)) {
-                JsonNode* root = json_parser_get_root(parser);
-                if (root && JSON_NODE_HOLDS_OBJECT(root)) {
-                    JsonObject* obj = json_node_get_object(root);
+            // Get current conditions
+            if (json_object_has_member(obj, "current_condition")) {
+                JsonArray* current = json_object_get_array_member(obj, "current_condition");
+                if (json_array_get_length(current) > 0) {
+                    JsonObject* cc = json_array_get_object_element(current, 0);
                     
-                    // Get current conditions
-                    if (json_object_has_member(obj, "current_condition")) {
-                        JsonArray* current = json_object_get_array_member(obj, "current_condition");
-                        if (json_array_get_length(current) > 0) {
-                            JsonObject* cc = json_array_get_object_element(current, 0);
-                            
-                            std::string tempC = safeGetString(cc, "temp_C");
-                            data.temperature = formatTemp(tempC, unit);
-                            
-                            std::string feelsC = safeGetString(cc, "FeelsLikeC");
-                            data.feelsLike = formatTemp(feelsC, unit);
-                            
-                            // Get weather code for icon
-                            data.conditionCode = safeGetString(cc, "weatherCode");
-                            
-                            // Get weather description
-                            if (json_object_has_member(cc, "weatherDesc")) {
-                                JsonArray* descArr = json_object_get_array_member(cc, "weatherDesc");
-                                if (json_array_get_length(descArr) > 0) {
-                                    JsonObject* descObj = json_array_get_object_element(descArr, 0);
-                                    data.condition = safeGetString(descObj, "value");
-                                }
-                            }
-                            
-                            data.humidity = safeGetString(cc, "humidity") + "%";
-                            
-                            std::string windSpeed = safeGetString(cc, "windspeedMiles");
-                            std::string windDir = safeGetString(cc, "winddir16Point");
-                            data.wind = windSpeed + " mph " + windDir;
+                    std::string tempC = safeGetString(cc, "temp_C");
+                    data.temperature = formatTemp(tempC, unit);
+                    
+                    std::string feelsC = safeGetString(cc, "FeelsLikeC");
+                    data.feelsLike = formatTemp(feelsC, unit);
+                    
+                    // Get weather code for icon
+                    data.conditionCode = safeGetString(cc, "weatherCode");
+                    
+                    // Get weather description
+                    if (json_object_has_member(cc, "weatherDesc")) {
+                        JsonArray* descArr = json_object_get_array_member(cc, "weatherDesc");
+                        if (json_array_get_length(descArr) > 0) {
+                            JsonObject* descObj = json_array_get_object_element(descArr, 0);
+                            data.condition = safeGetString(descObj, "value");
                         }
                     }
                     
-                    // Get location name and country
-                    if (json_object_has_member(obj, "nearest_area")) {
-                        JsonArray* areas = json_object_get_array_member(obj, "nearest_area");
-                        if (json_array_get_length(areas) > 0) {
-                            JsonObject* area = json_array_get_object_element(areas, 0);
-                            
-                            std::string city = "";
-                            std::string country = "";
-                            
-                            if (json_object_has_member(area, "areaName")) {
-                                JsonArray* nameArr = json_object_get_array_member(area, "areaName");
-                                if (json_array_get_length(nameArr) > 0) {
-                                    JsonObject* nameObj = json_array_get_object_element(nameArr, 0);
-                                    city = safeGetString(nameObj, "value");
-                                }
-                            }
-                            if (json_object_has_member(area, "country")) {
-                                JsonArray* countryArr = json_object_get_array_member(area, "country");
-                                if (json_array_get_length(countryArr) > 0) {
-                                    JsonObject* countryObj = json_array_get_object_element(countryArr, 0);
-                                    country = safeGetString(countryObj, "value");
-                                }
+                    data.humidity = safeGetString(cc, "humidity") + "%";
+                    
+                    std::string windSpeed = safeGetString(cc, "windspeedMiles");
+                    std::string windDir = safeGetString(cc, "winddir16Point");
+                    data.wind = windSpeed + " mph " + windDir;
+                }
+            }
+            
+            // Get location name and country
+            if (json_object_has_member(obj, "nearest_area")) {
+                JsonArray* areas = json_object_get_array_member(obj, "nearest_area");
+                if (json_array_get_length(areas) > 0) {
+                    JsonObject* area = json_array_get_object_element(areas, 0);
+                    
+                    std::string city = "";
+                    std::string country = "";
+                    
+                    if (json_object_has_member(area, "areaName")) {
+                        JsonArray* nameArr = json_object_get_array_member(area, "areaName");
+                        if (json_array_get_length(nameArr) > 0) {
+                            JsonObject* nameObj = json_array_get_object_element(nameArr, 0);
+                            city = safeGetString(nameObj, "value");
+                        }
+                    }
+                    if (json_object_has_member(area, "country")) {
+                        JsonArray* countryArr = json_object_get_array_member(area, "country");
+                        if (json_array_get_length(countryArr) > 0) {
+                            JsonObject* countryObj = json_array_get_object_element(countryArr, 0);
+                            country = safeGetString(countryObj, "value");
+                        }
+                    }
+                    
+                    data.location = city;
+                    data.country = country;
+                }
+            }
+            
+            // Get forecast (wttr.in provides 3 days)
+            if (json_object_has_member(obj, "weather")) {
+                JsonArray* weather = json_object_get_array_member(obj, "weather");
+                guint numDays = json_array_get_length(weather);
+                
+                const char* dayNames[] = {"Today", "Tomorrow"};
+                
+                for (guint i = 0; i < numDays && i < 3; i++) {
+                    JsonObject* day = json_array_get_object_element(weather, i);
+                    WeatherData::Forecast f;
+                    
+                    // Get date and convert to day name
+                    if (i < 2) {
+                        f.day = dayNames[i];
+                    } else {
+                        std::string dateStr = safeGetString(day, "date");
+                        f.day = "Day 3";
+                        
+                        if (!dateStr.empty()) {
+                            int year, month, dayNum;
+                            if (sscanf(dateStr.c_str(), "%d-%d-%d", &year, &month, &dayNum) == 3) {
+                                if (month < 3) { month += 12; year--; }
+                                int dow = (dayNum + 13*(month+1)/5 + year + year/4 - year/100 + year/400) % 7;
+                                const char* weekDays[] = {"Sat", "Sun", "Mon", "Tue", "Wed", "Thu", "Fri"};
+                                f.day = weekDays[dow];
                             }
-                            
-                            data.location = city;
-                            data.country = country;
                         }
                     }
                     
-                    // Get forecast (wttr.in provides 3 days)
-                    if (json_object_has_member(obj, "weather")) {
-                        JsonArray* weather = json_object_get_array_member(obj, "weather");
-                        guint numDays = json_array_get_length(weather);
+                    std::string maxC = safeGetString(day, "maxtempC");
+                    std::string minC = safeGetString(day, "mintempC");
+                    f.high = formatTemp(maxC, unit);
+                    f.low = formatTemp(minC, unit);
+                    
+                    // Get condition for the day (from hourly, use midday)
+                    if (json_object_has_member(day, "hourly")) {
+                        JsonArray* hourly = json_object_get_array_member(day, "hourly");
+                        guint idx = (json_array_get_length(hourly) > 4) ? 4 : 0;
+                        JsonObject* hour = json_array_get_object_element(hourly, idx);
                         
-                        const char* dayNames[] = {"Today", "Tomorrow"};
+                        f.conditionCode = safeGetString(hour, "weatherCode");
                         
-                        for (guint i = 0; i < numDays && i < 3; i++) {
-                            JsonObject* day = json_array_get_object_element(weather, i);
-                            WeatherData::Forecast f;
-                            
-                            // Get date and convert to day name
-                            if (i < 2) {
-                                f.day = dayNames[i];
-                            } else {
-                                std::string dateStr = safeGetString(day, "date");
-                                f.day = "Day 3";
-                                
-                                if (!dateStr.empty()) {
-                                    int year, month, dayNum;
-                                    if (sscanf(dateStr.c_str(), "%d-%d-%d", &year, &month, &dayNum) == 3) {
-                                        if (month < 3) { month += 12; year--; }
-                                        int dow = (dayNum + 13*(month+1)/5 + year + year/4 - year/100 + year/400) % 7;
-                                        const char* weekDays[] = {"Sat", "Sun", "Mon", "Tue", "Wed", "Thu", "Fri"};
-                                        f.day = weekDays[dow];
-                                    }
-                                }
+                        if (json_object_has_member(hour, "weatherDesc")) {
+                            JsonArray* descArr = json_object_get_array_member(hour, "weatherDesc");
+                            if (json_array_get_length(descArr) > 0) {
+                                JsonObject* descObj = json_array_get_object_element(descArr, 0);
+                                f.condition = safeGetString(descObj, "value");
                             }
-                            
-                            std::string maxC = safeGetString(day, "maxtempC");
-                            std::string minC = safeGetString(day, "mintempC");
-                            f.high = formatTemp(maxC, unit);
-                            f.low = formatTemp(minC, unit);
-                            
-                            // Get condition for the day (from hourly, use midday)
-                            if (json_object_has_member(day, "hourly")) {
-                                JsonArray* hourly = json_object_get_array_member(day, "hourly");
-                                guint idx = (json_array_get_length(hourly) > 4) ? 4 : 0;
-                                JsonObject* hour = json_array_get_object_element(hourly, idx);
-                                
-                                f.conditionCode = safeGetString(hour, "weatherCode");
-                                
-                                if (json_object_has_member(hour, "weatherDesc")) {
-                                    JsonArray* descArr = json_object_get_array_member(hour, "weatherDesc");
-                                    if (json_array_get_length(descArr) > 0) {
-                                        JsonObject* descObj = json_array_get_object_element(descArr, 0);
-                                        f.condition = safeGetString(descObj, "value");
-                                    }
-                                }
-                            }
-                            
-                            data.forecast.push_back(f);
                         }
                     }
                     
-                    // Get weather alerts if available
-                    if (json_object_has_member(obj, "alerts")) {
-                        JsonNode* alertsNode = json_object_get_member(obj, "alerts");
-                        if (JSON_NODE_HOLDS_OBJECT(alertsNode)) {
-                            JsonObject* alertsObj = json_node_get_object(alertsNode);
-                            if (json_object_has_member(alertsObj, "alert")) {
-                                JsonArray* alertArr = json_object_get_array_member(alertsObj, "alert");
-                                guint numAlerts = json_array_get_length(alertArr);
-                                for (guint i = 0; i < numAlerts && i < 5; i++) {
-                                    JsonObject* alert = json_array_get_object_element(alertArr, i);
-                                    WeatherData::Alert a;
-                                    a.headline = safeGetString(alert, "headline");
-                                    a.severity = safeGetString(alert, "severity");
-                                    a.description = safeGetString(alert, "desc");
-                                    a.expires = safeGetString(alert, "expires");
-                                    if (!a.headline.empty()) {
-                                        data.alerts.push_back(a);
-                                    }
-                                }
-                            }
-                        } else if (JSON_NODE_HOLDS_ARRAY(alertsNode)) {
-                            JsonArray* alertArr = json_node_get_array(alertsNode);
-                            guint numAlerts = json_array_get_length(alertArr);
-                            for (guint i = 0; i < numAlerts && i < 5; i++) {
-                                JsonObject* alert = json_array_get_object_element(alertArr, i);
-                                WeatherData::Alert a;
-                                a.headline = safeGetString(alert, "headline");
-                                a.severity = safeGetString(alert, "severity");
-                                a.description = safeGetString(alert, "desc");
-                                a.expires = safeGetString(alert, "expires");
-                                if (!a.headline.empty()) {
-                                    data.alerts.push_back(a);
-                                }
+                    data.forecast.push_back(f);
+                }
+            }
+            
+            // Get weather alerts if available
+            if (json_object_has_member(obj, "alerts")) {
+                JsonNode* alertsNode = json_object_get_member(obj, "alerts");
+                if (JSON_NODE_HOLDS_OBJECT(alertsNode)) {
+                    JsonObject* alertsObj = json_node_get_object(alertsNode);
+                    if (json_object_has_member(alertsObj, "alert")) {
+                        JsonArray* alertArr = json_object_get_array_member(alertsObj, "alert");
+                        guint numAlerts = json_array_get_length(alertArr);
+                        for (guint i = 0; i < numAlerts && i < 5; i++) {
+                            JsonObject* alert = json_array_get_object_element(alertArr, i);
+                            WeatherData::Alert a;
+                            a.headline = safeGetString(alert, "headline");
+                            a.severity = safeGetString(alert, "severity");
+                            a.description = safeGetString(alert, "desc");
+                            a.expires = safeGetString(alert, "expires");
+                            if (!a.headline.empty()) {
+                                data.alerts.push_back(a);
                             }
                         }
                     }
+                } else if (JSON_NODE_HOLDS_ARRAY(alertsNode)) {
+                    JsonArray* alertArr = json_node_get_array(alertsNode);
+                    guint numAlerts = json_array_get_length(alertArr);
+                    for (guint i = 0; i < numAlerts && i < 5; i++) {
+                        JsonObject* alert = json_array_get_object_element(alertArr, i);
+                        WeatherData::Alert a;
+                        a.headline = safeGetString(alert, "headline");
+                        a.severity = safeGetString(alert, "severity");
+                        a.description = safeGetString(alert, "desc");
+                        a.expires = safeGetString(alert, "expires");
+                        if (!a.headline.empty()) {
+                            data.alerts.push_back(a);
+                        }
+                    }
                 }
             }
-            
-            if (error) g_error_free(error);
-            g_object_unref(parser);
+        }
+    }
+    
+    if (error) g_error_free(error);
+    g_object_unref(parser);
+}
+
+void WeatherService::fetchWeather(const std::string& zipCode, std::function<void(WeatherData)> callback) {
+    // URL-encode the location for the API request
+    std::string encodedLocation = urlEncode(zipCode);
+    
+    // Fetch JSON format from wttr.in
+    std::string url = "https://wttr.in/" + encodedLocation + "?format=j1";
+    HttpClient().getAsync(url, [zipCode, encodedLocation, url, callback](HttpClient::Response response) {
+        WeatherData data;
+        data.zipCode = zipCode;
+        TempUnit unit = Config::getInstance().getTempUnit();
+        
+        if (response.success && !response.body.empty()) {
+            parseWeatherJson(response.body, unit, data);
+            if (!data.temperature.empty()) {
+                HttpClient::storeCached(url, response);
+            }
+        }
+        if (!data.temperature.empty()) {
+            callback(data);
+            return;
         }
         
-        // Fallback if JSON parsing failed
-        if (data.temperature.empty()) {
-            std::string simpleUrl = "https://wttr.in/" + encodedLocation + "?format=%l|%t|%C|%h|%w";
-            auto simpleResp = client.get(simpleUrl);
-            
+        // Fallback if JSON parsing failed; chained rather than waited on,
+        // so this completion worker is free for other transfers meanwhile.
+        std::string simpleUrl = "https://wttr.in/" + encodedLocation + "?format=%l|%t|%C|%h|%w";
+        HttpClient().getAsync(simpleUrl, [data, callback](HttpClient::Response simpleResp) mutable {
             if (simpleResp.success && !simpleResp.body.empty()) {
                 std::vector<std::string> parts;
                 std::string part;
@@ -331,21 +296,43 @@ void WeatherService::fetchWeather(const std::string& zipCode, std::function<void
                 if (!part.empty()) parts.push_back(part);
                 
                 if (parts.size() >= 5) {
-                    data.location = sanitizeUtf8(parts[0].c_str());
-                    data.temperature = sanitizeUtf8(parts[1].c_str());
-                    data.condition = sanitizeUtf8(parts[2].c_str());
-                    data.humidity = sanitizeUtf8(parts[3].c_str());
-                    data.wind = sanitizeUtf8(parts[4].c_str());
+                    data.location = Utf8::sanitize(parts[0]);
+                    data.temperature = Utf8::sanitize(parts[1]);
+                    data.condition = Utf8::sanitize(parts[2]);
+                    data.humidity = Utf8::sanitize(parts[3]);
+                    data.wind = Utf8::sanitize(parts[4]);
                 }
             }
+            callback(data);
+        });
+    });
+}
+
+void WeatherService::loadCachedLocations(std::function<void(std::vector<WeatherData>)> callback) {
+    std::vector<std::string> locations = *Config::getInstance().getWeatherLocations();
+    if (locations.empty()) {
+        locations.push_back("auto");
+    }
+    
+    HttpEngine::getInstance().post([locations, callback]() {
+        TempUnit unit = Config::getInstance().getTempUnit();
+        std::vector<WeatherData> results;
+        for (const auto& location : locations) {
+            std::string url = "https://wttr.in/" + urlEncode(location) + "?format=j1";
+            HttpClient::Response cached;
+            if (!HttpClient::getCached(url, cached)) continue;
+            
+            WeatherData data;
+            data.zipCode = location;
+            parseWeatherJson(cached.body, unit, data);
+            if (!data.temperature.empty()) results.push_back(data);
         }
-        
-        callback(data);
-    }).detach();
+        callback(results);
+    });
 }
 
 void WeatherService::fetchAllLocations(std::function<void(std::vector<WeatherData>)> callback) {
-    auto locations = Config::getInstance().getWeatherLocations();
+    std::vector<std::string> locations = *Config::getInstance().getWeatherLocations();
     if (locations.empty()) {
         locations.push_back("auto");
     }
@@ -0,0 +1,84 @@
+#include "ui/ArticleListModel.hpp"
+#include <utility>
+
+// GObject boilerplate stays at file scope; only the static wrappers in
+// ArticleListModel are visible to the rest of the program.
+
+G_DECLARE_FINAL_TYPE(InfoDashArticleItem, infodash_article_item, INFODASH, ARTICLE_ITEM, GObject)
+
+struct _InfoDashArticleItem {
+    GObject parent_instance;
+    guint index;
+};
+
+G_DEFINE_TYPE(InfoDashArticleItem, infodash_article_item, G_TYPE_OBJECT)
+
+static void infodash_article_item_class_init(InfoDashArticleItemClass*) {}
+static void infodash_article_item_init(InfoDashArticleItem*) {}
+
+G_DECLARE_FINAL_TYPE(InfoDashArticleList, infodash_article_list, INFODASH, ARTICLE_LIST, GObject)
+
+// GObject memory is zeroed, not constructed, so the vector lives behind a
+// pointer created in init and freed in finalize.
+struct _InfoDashArticleList {
+    GObject parent_instance;
+    std::vector<InfoDash::ArticleStore::Index>* indices;
+};
+
+static GType articleListItemType(GListModel*) {
+    return infodash_article_item_get_type();
+}
+
+static guint articleListNItems(GListModel* model) {
+    return INFODASH_ARTICLE_LIST(model)->indices->size();
+}
+
+static gpointer articleListItem(GListModel* model, guint position) {
+    const auto& indices = *INFODASH_ARTICLE_LIST(model)->indices;
+    if (position >= indices.size()) return nullptr;
+    auto* item = INFODASH_ARTICLE_ITEM(g_object_new(infodash_article_item_get_type(), nullptr));
+    item->index = indices[position];
+    return item;
+}
+
+static void infodash_article_list_model_init(GListModelInterface* iface) {
+    iface->get_item_type = articleListItemType;
+    iface->get_n_items = articleListNItems;
+    iface->get_item = articleListItem;
+}
+
+G_DEFINE_TYPE_WITH_CODE(InfoDashArticleList, infodash_article_list, G_TYPE_OBJECT,
+                        G_IMPLEMENT_INTERFACE(G_TYPE_LIST_MODEL, infodash_article_list_model_init))
+
+static void infodash_article_list_finalize(GObject* object) {
+    delete INFODASH_ARTICLE_LIST(object)->indices;
+    G_OBJECT_CLASS(infodash_article_list_parent_class)->finalize(object);
+}
+
+static void infodash_article_list_class_init(InfoDashArticleListClass* klass) {
+    G_OBJECT_CLASS(klass)->finalize = infodash_article_list_finalize;
+}
+
+static void infodash_article_list_init(InfoDashArticleList* self) {
+    self->indices = new std::vector<InfoDash::ArticleStore::Index>();
+}
+
+namespace InfoDash {
+
+GListModel* ArticleListModel::create() {
+    return G_LIST_MODEL(g_object_new(infodash_article_list_get_type(), nullptr));
+}
+
+void ArticleListModel::setIndices(GListModel* model, std::vector<ArticleStore::Index> indices) {
+    auto* list = INFODASH_ARTICLE_LIST(model);
+    guint removed = list->indices->size();
+    *list->indices = std::move(indices);
+    guint added = list->indices->size();
+    if (removed || added) g_list_model_items_changed(model, 0, removed, added);
+}
+
+ArticleStore::Index ArticleListModel::indexOf(gpointer item) {
+    return INFODASH_ARTICLE_ITEM(item)->index;
+}
+
+}
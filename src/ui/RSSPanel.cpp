@@ -1,23 +1,76 @@
 #include "ui/RSSPanel.hpp"
+#include "ui/ArticleListModel.hpp"
+#include "services/ArticleArchive.hpp"
 #include "utils/Config.hpp"
-#include <thread>
+#include "utils/DiskCache.hpp"
+#include "utils/HttpClient.hpp"
+#include "utils/HttpEngine.hpp"
+#include "utils/ImageCache.hpp"
+#include "utils/ImageDecoder.hpp"
+#include "utils/UiDispatcher.hpp"
 #include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
 #include <mutex>
-#include <curl/curl.h>
+#include <numeric>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <libxml/HTMLparser.h>
 #include <libxml/xpath.h>
 #include <gdk-pixbuf/gdk-pixbuf.h>
-#include <cairo.h>
 
 namespace InfoDash {
 
-// Image cache for article cards
-struct ImageData { GdkPixbuf* pixbuf; int width; int height; };
-static std::map<std::string, ImageData> imageCache;
+// One article image being loaded for the pictures waiting on it. Loads
+// are queued until one of kMaxImageLoads slots is free; a load whose last
+// picture goes away, and that no picture has asked for again by the next
+// pump, is dropped from the queue, or cancelled if running.
+struct ImageLoad {
+    std::string url;
+    std::string key;  // ImageCache key: URL and decoded size
+    int width = 0;
+    int height = 0;
+    std::vector<GtkWidget*> waiting;  // referenced
+    std::shared_ptr<std::atomic<bool>> cancelled = std::make_shared<std::atomic<bool>>(false);
+    bool started = false;
+};
+static constexpr size_t kMaxImageLoads = 6;
+static std::unordered_map<std::string, std::shared_ptr<ImageLoad>> imageLoads;  // by key
+static size_t runningImageLoads = 0;
+static std::unordered_set<std::string> failedImages;  // URLs that could not be fetched
+// Lead images resolved within this many milliseconds are applied together.
+static constexpr unsigned kImageWindowMs = 250;
 
 // Favicon cache for feeds
 static std::map<std::string, GdkPixbuf*> faviconCache;
 
+// Merge per-feed lists newest first into one store, naming each article
+// after its feed rather than the host the service filled in, and index
+// every article for search as it is added. `order` is then every index.
+static void buildArticles(std::vector<std::vector<RSSItem>> lists, const std::vector<std::string>& sources,
+                          ArticleStore& store, SearchIndex& index, std::vector<ArticleStore::Index>& order) {
+    std::vector<uint32_t> origin;
+    auto merged = RSSService::mergeByDate(std::move(lists), &origin);
+    size_t textBytes = 0;
+    for (const auto& item : merged) {
+        textBytes += item.title.size() + item.link.size() + item.description.size() +
+                     item.pubDate.size() + item.imageUrl.size() + 5;
+    }
+    store.clear();
+    index.clear();
+    store.reserve(merged.size(), textBytes);
+    for (size_t k = 0; k < merged.size(); ++k) {
+        ArticleStore::Index i = store.add(merged[k], sources[origin[k]]);
+        index.add(i, merged[k].title, merged[k].description, merged[k].author);
+    }
+    index.prepare();
+    order.resize(store.size());
+    std::iota(order.begin(), order.end(), 0);
+}
+
 // Helper to get favicon URL from feed URL using Google's favicon service
 static std::string getFaviconUrl(const std::string& feedUrl) {
     // Extract domain from feed URL
@@ -30,32 +83,273 @@ static std::string getFaviconUrl(const std::string& feedUrl) {
     return "https://www.google.com/s2/favicons?sz=32&domain=" + domain;
 }
 
-static size_t WriteCallback(void* contents, size_t size, size_t nmemb, void* userp) {
-    size_t total = size * nmemb;
-    static_cast<std::string*>(userp)->append(static_cast<char*>(contents), total);
-    return total;
-}
-
-static void onDrawImage(GtkDrawingArea* area, cairo_t* cr, int w, int h, gpointer) {
-    const char* url = static_cast<const char*>(g_object_get_data(G_OBJECT(area), "image-url"));
-    if (!url) return;
-    auto it = imageCache.find(url);
-    if (it != imageCache.end() && it->second.pixbuf) {
-        double scale = std::min((double)w / it->second.width, (double)h / it->second.height);
-        int nw = it->second.width * scale, nh = it->second.height * scale;
-        int x = (w - nw) / 2, y = (h - nh) / 2;
-        cairo_save(cr);
-        cairo_translate(cr, x, y);
-        cairo_scale(cr, scale, scale);
+static void showFavicon(GtkWidget* image, GdkPixbuf* pixbuf) {
 G_GNUC_BEGIN_IGNORE_DEPRECATIONS
-        gdk_cairo_set_source_pixbuf(cr, it->second.pixbuf, 0, 0);
+    GdkTexture* texture = gdk_texture_new_for_pixbuf(pixbuf);
 G_GNUC_END_IGNORE_DEPRECATIONS
-        cairo_paint(cr);
-        cairo_restore(cr);
+    gtk_image_set_from_paintable(GTK_IMAGE(image), GDK_PAINTABLE(texture));
+    g_object_unref(texture);
+    gtk_widget_remove_css_class(image, "dim-label");
+}
+
+// Show the 16x16 favicon at `url` in `image`: from faviconCache, else from
+// the thumbnail disk cache, else downloaded and stored there. Each favicon
+// is looked up once per run; failures are not retried.
+static void loadFavicon(const std::string& url, GtkWidget* image) {
+    auto cached = faviconCache.find(url);
+    if (cached != faviconCache.end()) {
+        if (cached->second) showFavicon(image, cached->second);
+        return;
+    }
+    faviconCache[url] = nullptr;
+    g_object_ref(image);
+    auto publish = [url, image](GdkPixbuf* pixbuf) {
+        UiDispatcher::getInstance().post([url, image, pixbuf]() {
+            if (pixbuf) {
+                faviconCache[url] = pixbuf;
+                if (GTK_IS_IMAGE(image)) showFavicon(image, pixbuf);
+            }
+            g_object_unref(image);
+        });
+    };
+    HttpEngine::getInstance().post([url, publish]() {
+        std::string stored;
+        if (DiskCache::thumbnails().get("favicon:" + url, stored)) {
+            if (GdkPixbuf* pixbuf = ImageDecoder::decodeAtSize(stored, 16, 16)) {
+                publish(pixbuf);
+                return;
+            }
+        }
+        HttpClient client;
+        client.setTimeout(10);
+        client.getAsync(url, [url, publish](HttpClient::Response response) {
+            GdkPixbuf* pixbuf = nullptr;
+            if (response.success && !response.body.empty()) {
+                pixbuf = ImageDecoder::decodeAtSize(response.body, 16, 16);
+            }
+            if (pixbuf) {
+                std::string encoded = ImageDecoder::encode(pixbuf);
+                if (!encoded.empty()) DiskCache::thumbnails().put("favicon:" + url, encoded);
+            }
+            publish(pixbuf);
+        });
+    });
+}
+
+static void setArticlePicture(GtkWidget* picture, GdkTexture* texture) {
+    gtk_picture_set_paintable(GTK_PICTURE(picture), texture ? GDK_PAINTABLE(texture) : nullptr);
+    if (texture) gtk_widget_remove_css_class(picture, "loading");
+    else gtk_widget_add_css_class(picture, "loading");
+}
+
+// Pixels between `picture` and the visible part of its scrolled window;
+// 0 if on screen. Pictures not mapped count as furthest away.
+static double viewportDistance(GtkWidget* picture) {
+    GtkWidget* viewport = gtk_widget_get_ancestor(picture, GTK_TYPE_SCROLLED_WINDOW);
+    graphene_rect_t bounds;
+    if (!viewport || !gtk_widget_get_mapped(picture) ||
+        !gtk_widget_compute_bounds(picture, viewport, &bounds)) {
+        return std::numeric_limits<double>::max();
+    }
+    double top = bounds.origin.y;
+    double bottom = top + bounds.size.height;
+    double height = gtk_widget_get_height(viewport);
+    if (bottom < 0) return -bottom;
+    if (top > height) return top - height;
+    return 0;
+}
+
+static void startImageLoad(const std::shared_ptr<ImageLoad>& load);
+
+// Drop loads nobody waits for any more, then start queued loads while
+// slots are free, nearest the viewport first. Distances are taken now
+// rather than when a load was queued, since the view may have scrolled
+// since; the queue is only as long as the number of bound pictures, so a
+// scan is cheap.
+static void pumpImageLoads() {
+    for (auto it = imageLoads.begin(); it != imageLoads.end();) {
+        if (!it->second->waiting.empty()) {
+            ++it;
+            continue;
+        }
+        // Running loads keep their slot until the aborted transfer reports back.
+        it->second->cancelled->store(true);
+        it = imageLoads.erase(it);
+    }
+    while (runningImageLoads < kMaxImageLoads) {
+        std::shared_ptr<ImageLoad> next;
+        double nearest = 0;
+        for (const auto& [key, load] : imageLoads) {
+            if (load->started) continue;
+            double distance = std::numeric_limits<double>::max();
+            for (GtkWidget* picture : load->waiting) {
+                distance = std::min(distance, viewportDistance(picture));
+            }
+            if (!next || distance < nearest) {
+                next = load;
+                nearest = distance;
+            }
+        }
+        if (!next) return;
+        startImageLoad(next);
+    }
+}
+
+// Pictures are bound before they are laid out and mapped, so a request
+// only queues; the queue is served on the next frame, when distances mean
+// something.
+static void schedulePumpImageLoads() {
+    static bool scheduled = false;
+    if (std::exchange(scheduled, true)) return;
+    UiDispatcher::getInstance().post([]() {
+        scheduled = false;
+        pumpImageLoads();
+    });
+}
+
+// Ask for the image at `key` to be shown in `picture` once loaded.
+static void requestArticleImage(const std::string& imgUrl, const std::string& key,
+                                int width, int height, GtkWidget* picture) {
+    if (failedImages.count(imgUrl)) return;
+    auto& load = imageLoads[key];
+    if (!load) {
+        load = std::make_shared<ImageLoad>();
+        load->url = imgUrl;
+        load->key = key;
+        load->width = width;
+        load->height = height;
+    }
+    if (std::find(load->waiting.begin(), load->waiting.end(), picture) == load->waiting.end()) {
+        load->waiting.push_back(GTK_WIDGET(g_object_ref(picture)));
+    }
+    schedulePumpImageLoads();
+}
+
+// Whether `picture` is still waiting on the load for `key`.
+static bool isWaitingForImage(GtkWidget* picture, const std::string& key) {
+    auto it = imageLoads.find(key);
+    if (it == imageLoads.end()) return false;
+    const auto& waiting = it->second->waiting;
+    return std::find(waiting.begin(), waiting.end(), picture) != waiting.end();
+}
+
+// `picture` no longer wants the image it asked for: it was unbound, which
+// the views do once a row is scrolled well out of sight or the list is
+// replaced, or it is being rebound to another article. A load left without
+// pictures is only given up at the next pump, so a row that is unbound and
+// bound again within a frame, as list views do when items change, does
+// not restart its download.
+static void releaseArticleImage(GtkWidget* picture) {
+    const char* key = static_cast<const char*>(g_object_get_data(G_OBJECT(picture), "image-key"));
+    if (!key) return;
+    auto it = imageLoads.find(key);
+    if (it == imageLoads.end()) return;
+    auto& waiting = it->second->waiting;
+    auto pos = std::find(waiting.begin(), waiting.end(), picture);
+    if (pos == waiting.end()) return;
+    waiting.erase(pos);
+    g_object_unref(picture);
+    if (waiting.empty()) schedulePumpImageLoads();
+}
+
+// Load an article image at the size it is shown at: from the thumbnail
+// disk cache if it was scaled before, else through the shared HTTP engine,
+// with ImageDecoder scaling it and storing the thumbnail. The texture is
+// published to ImageCache on the main thread and shown in the pictures
+// still waiting for it.
+static void startImageLoad(const std::shared_ptr<ImageLoad>& load) {
+    load->started = true;
+    ++runningImageLoads;
+    
+    // `failed` is set for images that will never load, not for cancelled
+    // loads or decodes dropped from a full queue; those are retried at the
+    // next bind.
+    auto publish = [load](GdkTexture* texture, bool failed) {
+        UiDispatcher::getInstance().post([load, texture, failed]() {
+            --runningImageLoads;
+            if (texture) ImageCache::getInstance().insert(load->key, texture);
+            if (failed) failedImages.insert(load->url);
+            auto it = imageLoads.find(load->key);
+            if (it != imageLoads.end() && it->second == load) {
+                imageLoads.erase(it);
+                for (GtkWidget* picture : load->waiting) {
+                    if (texture) setArticlePicture(picture, texture);
+                    g_object_unref(picture);
+                }
+                load->waiting.clear();
+            }
+            pumpImageLoads();
+        });
+    };
+    auto decoded = [publish](GdkTexture* texture, bool dropped) {
+        publish(texture, !texture && !dropped);
+    };
+    HttpEngine::getInstance().post([load, publish, decoded]() {
+        if (load->cancelled->load()) {
+            publish(nullptr, false);
+            return;
+        }
+        std::string thumbnail;
+        if (DiskCache::thumbnails().get("thumb:" + load->key, thumbnail)) {
+            ImageDecoder::getInstance().decode(std::move(thumbnail), load->width, load->height, "", decoded);
+            return;
+        }
+        HttpClient client;
+        client.setTimeout(10);
+        HttpClient::Request request = client.makeRequest(load->url);
+        request.cancelled = load->cancelled;
+        client.getAsync(std::move(request), [load, publish, decoded](HttpClient::Response response) {
+            if (load->cancelled->load()) {
+                publish(nullptr, false);
+                return;
+            }
+            if (!response.success || response.body.empty()) {
+                publish(nullptr, true);
+                return;
+            }
+            ImageDecoder::getInstance().decode(std::move(response.body), load->width, load->height,
+                                               "thumb:" + load->key, decoded);
+        });
+    });
+}
+
+static void logImageCacheStats() {
+    ImageCache& cache = ImageCache::getInstance();
+    ImageCache::Stats stats = cache.stats();
+    g_debug("image cache: %" G_GUINT64_FORMAT " hits, %" G_GUINT64_FORMAT " misses, %" G_GUINT64_FORMAT
+            " evictions; %zu textures, %zu of %zu KiB",
+            stats.hits, stats.misses, stats.evictions, stats.entries, stats.bytes >> 10, cache.budget() >> 10);
+}
+
+// Show `imageUrl` in the image box of a card or row, or the placeholder if
+// there is none.
+static void showArticleImage(GtkWidget* root, const std::string& imageUrl) {
+    GtkWidget* imageArea = static_cast<GtkWidget*>(g_object_get_data(G_OBJECT(root), "image"));
+    GtkWidget* placeholder = static_cast<GtkWidget*>(g_object_get_data(G_OBJECT(root), "placeholder"));
+    gtk_widget_set_visible(imageArea, !imageUrl.empty());
+    gtk_widget_set_visible(placeholder, imageUrl.empty());
+    if (!imageUrl.empty()) {
+        // Decoded for the box it is shown in, at the display's scale; a
+        // cache miss (new or evicted) fetches it again.
+        int width = 0, height = 0;
+        gtk_widget_get_size_request(imageArea, &width, &height);
+        int scale = gtk_widget_get_scale_factor(imageArea);
+        width *= scale;
+        height *= scale;
+        std::string key = imageUrl + "@" + std::to_string(width) + "x" + std::to_string(height);
+        // Rebound to the same image it is still loading: leave it waiting.
+        const char* current = static_cast<const char*>(g_object_get_data(G_OBJECT(imageArea), "image-key"));
+        if (!current || key != current || !isWaitingForImage(imageArea, key)) {
+            releaseArticleImage(imageArea);
+            g_object_set_data_full(G_OBJECT(imageArea), "image-key", g_strdup(key.c_str()), g_free);
+            GdkTexture* texture = ImageCache::getInstance().lookup(key);
+            setArticlePicture(imageArea, texture);
+            if (!texture) requestArticleImage(imageUrl, key, width, height, imageArea);
+        }
     } else {
-        cairo_set_source_rgb(cr, 0.3, 0.3, 0.3);
-        cairo_rectangle(cr, 0, 0, w, h);
-        cairo_fill(cr);
+        releaseArticleImage(imageArea);
+        g_object_set_data(G_OBJECT(imageArea), "image-key", nullptr);
+        setArticlePicture(imageArea, nullptr);
     }
 }
 
@@ -67,14 +361,53 @@ static void onCardClicked(GtkGestureClick*, gint, gdouble, gdouble, gpointer dat
     }
 }
 
+// The article views keep their scroll position across model updates, which
+// suits refreshes but not a change of what is being shown.
+static void scrollToTop(GtkWidget* scrolled) {
+    gtk_adjustment_set_value(gtk_scrolled_window_get_vadjustment(GTK_SCROLLED_WINDOW(scrolled)), 0);
+}
+
+// Plain-text excerpt of a description: the first `limit` bytes with tags
+// dropped and runs of spaces collapsed.
+static std::string descriptionExcerpt(std::string_view html, size_t limit) {
+    std::string desc(html.substr(0, limit));
+    size_t lt = desc.find('<');
+    while (lt != std::string::npos) {
+        size_t gt = desc.find('>', lt);
+        if (gt != std::string::npos) desc.erase(lt, gt - lt + 1);
+        else break;
+        lt = desc.find('<');
+    }
+    size_t pos = 0;
+    while ((pos = desc.find("  ")) != std::string::npos) {
+        desc.erase(pos, 1);
+    }
+    return desc;
+}
+
+static void setCssClass(GtkWidget* widget, const char* name, bool on) {
+    if (on) gtk_widget_add_css_class(widget, name);
+    else gtk_widget_remove_css_class(widget, name);
+}
+
+// Article currently bound to a card or row, or ArticleStore::kNoId. The
+// widget is recycled as the view scrolls, so handlers must ask at click
+// time rather than capture an index when the widget is built.
+static ArticleStore::Index boundArticle(GtkWidget* root) {
+    auto* listItem = static_cast<GtkListItem*>(g_object_get_data(G_OBJECT(root), "list-item"));
+    gpointer item = listItem ? gtk_list_item_get_item(listItem) : nullptr;
+    return item ? ArticleListModel::indexOf(item) : ArticleStore::kNoId;
+}
+
 static gboolean onToggleState(GtkSwitch* sw, gboolean state, gpointer) {
     std::string* url = static_cast<std::string*>(g_object_get_data(G_OBJECT(sw), "feed-url"));
     if (url) {
         auto feeds = Config::getInstance().getFeeds();
-        for (auto& f : feeds) {
+        for (const auto& f : *feeds) {
             if (f.url == *url) {
-                f.enabled = state;
-                Config::getInstance().updateFeed(*url, f);
+                FeedInfo changed = f;
+                changed.enabled = state;
+                Config::getInstance().updateFeed(*url, changed);
                 break;
             }
         }
@@ -83,18 +416,19 @@ static gboolean onToggleState(GtkSwitch* sw, gboolean state, gpointer) {
 }
 
 RSSPanel::RSSPanel() : mainPaned_(nullptr), categoryList_(nullptr), 
-                       articlesContainer_(nullptr), articlesScrolled_(nullptr),
+                       articlesView_(nullptr), articleModel_(ArticleListModel::create()),
+                       articlesScrolled_(nullptr),
                        categoryTitle_(nullptr), layoutToggleBtn_(nullptr),
                        currentCategory_("all"), currentFeed_("") {
+    ImageCache::getInstance().setBudget(size_t(Config::getInstance().getImageCacheMB()) << 20);
     setupUI();
+    loadCachedFeeds();  // last-known articles first, then revalidate
     loadFeeds();
 }
 
 RSSPanel::~RSSPanel() {
-    for (auto& pair : imageCache) {
-        if (pair.second.pixbuf) g_object_unref(pair.second.pixbuf);
-    }
-    imageCache.clear();
+    ImageCache::getInstance().clear();
+    g_object_unref(articleModel_);
 }
 
 void RSSPanel::setupUI() {
@@ -130,6 +464,14 @@ void RSSPanel::setupSidebar() {
     gtk_box_append(GTK_BOX(headerBox), addBtn);
     gtk_box_append(GTK_BOX(sidebar), headerBox);
     
+    GtkWidget* search = gtk_search_entry_new();
+    gtk_search_entry_set_placeholder_text(GTK_SEARCH_ENTRY(search), "Search articles");
+    gtk_widget_set_margin_start(search, 12);
+    gtk_widget_set_margin_end(search, 12);
+    gtk_widget_set_margin_bottom(search, 8);
+    g_signal_connect(search, "search-changed", G_CALLBACK(onSearchChanged), this);
+    gtk_box_append(GTK_BOX(sidebar), search);
+    
     GtkWidget* scrolled = gtk_scrolled_window_new();
     gtk_scrolled_window_set_policy(GTK_SCROLLED_WINDOW(scrolled), GTK_POLICY_NEVER, GTK_POLICY_AUTOMATIC);
     gtk_widget_set_vexpand(scrolled, TRUE);
@@ -218,18 +560,7 @@ void RSSPanel::setupContentArea() {
     gtk_scrolled_window_set_policy(GTK_SCROLLED_WINDOW(articlesScrolled_), GTK_POLICY_NEVER, GTK_POLICY_AUTOMATIC);
     gtk_widget_set_vexpand(articlesScrolled_, TRUE);
     
-    articlesContainer_ = gtk_flow_box_new();
-    gtk_flow_box_set_selection_mode(GTK_FLOW_BOX(articlesContainer_), GTK_SELECTION_NONE);
-    gtk_flow_box_set_homogeneous(GTK_FLOW_BOX(articlesContainer_), TRUE);
-    gtk_flow_box_set_min_children_per_line(GTK_FLOW_BOX(articlesContainer_), 1);
-    gtk_flow_box_set_max_children_per_line(GTK_FLOW_BOX(articlesContainer_), 4);
-    gtk_flow_box_set_column_spacing(GTK_FLOW_BOX(articlesContainer_), 16);
-    gtk_flow_box_set_row_spacing(GTK_FLOW_BOX(articlesContainer_), 16);
-    gtk_widget_set_margin_start(articlesContainer_, 16);
-    gtk_widget_set_margin_end(articlesContainer_, 16);
-    gtk_widget_set_margin_top(articlesContainer_, 16);
-    gtk_widget_set_margin_bottom(articlesContainer_, 16);
-    gtk_scrolled_window_set_child(GTK_SCROLLED_WINDOW(articlesScrolled_), articlesContainer_);
+    showArticleView(isListMode);
     gtk_box_append(GTK_BOX(content), articlesScrolled_);
     
     gtk_paned_set_end_child(GTK_PANED(mainPaned_), content);
@@ -245,52 +576,53 @@ void RSSPanel::updateLayoutToggle() {
         isListMode ? "Switch to Cards" : "Switch to List");
 }
 
+// The view is rebuilt only when the layout changes. Otherwise new contents
+// arrive through articleModel_, and the view rebinds just the rows it shows.
+void RSSPanel::showArticleView(bool listMode) {
+    if (articlesView_ && listMode == listLayout_) return;
+    listLayout_ = listMode;
+    boundWidgets_.clear();
+    
+    GtkListItemFactory* factory = gtk_signal_list_item_factory_new();
+    g_signal_connect(factory, "setup", G_CALLBACK(listMode ? onListRowSetup : onCardSetup), this);
+    g_signal_connect(factory, "bind", G_CALLBACK(onArticleBind), this);
+    g_signal_connect(factory, "unbind", G_CALLBACK(onArticleUnbind), this);
+    GtkSelectionModel* selection = GTK_SELECTION_MODEL(
+        gtk_no_selection_new(G_LIST_MODEL(g_object_ref(articleModel_))));
+    
+    if (listMode) {
+        articlesView_ = gtk_list_view_new(selection, factory);
+        gtk_widget_add_css_class(articlesView_, "boxed-list");
+    } else {
+        articlesView_ = gtk_grid_view_new(selection, factory);
+        gtk_grid_view_set_min_columns(GTK_GRID_VIEW(articlesView_), 1);
+        gtk_grid_view_set_max_columns(GTK_GRID_VIEW(articlesView_), 4);
+    }
+    gtk_widget_add_css_class(articlesView_, "article-view");
+    gtk_scrolled_window_set_child(GTK_SCROLLED_WINDOW(articlesScrolled_), articlesView_);
+}
+
 // Expandable sidebar with feeds
 void RSSPanel::updateSidebar() {
     GtkWidget* child;
     while ((child = gtk_widget_get_first_child(categoryList_))) 
         gtk_list_box_remove(GTK_LIST_BOX(categoryList_), child);
+    categoryBadges_.clear();
+    feedBadges_.clear();
     
     auto& config = Config::getInstance();
     auto feeds = config.getFeeds();
-    auto savedArticles = config.getSavedArticles();
+    unreadCounts_.assignCategories(articles_, *feeds);
     
-    // Helper to count unread for a feed
     auto countUnreadForFeed = [&](const std::string& feedName) -> int {
-        int count = 0;
-        for (const auto& item : allItems_) {
-            if (item.source == feedName && !config.isArticleRead(item.link)) count++;
-        }
-        return count;
-    };
-    
-    // Helper to count saved articles that actually exist in current feeds
-    auto countDisplayableSavedArticles = [&]() -> int {
-        int count = 0;
-        for (const auto& item : allItems_) {
-            if (savedArticles.count(item.link)) count++;
-        }
-        return count;
+        return unreadCounts_.source(articles_.findSource(feedName));
     };
     
-    // Helper to count unread for category
+    // "Saved" counts saved articles that actually exist in current feeds
     auto countUnreadForCategory = [&](const std::string& catId) -> int {
-        if (catId == "all") {
-            int total = 0;
-            for (const auto& item : allItems_) 
-                if (!config.isArticleRead(item.link)) total++;
-            return total;
-        }
-        if (catId == "saved") {
-            return countDisplayableSavedArticles();
-        }
-        int count = 0;
-        for (const auto& f : feeds) {
-            if (f.category == catId && f.enabled) {
-                count += countUnreadForFeed(f.name);
-            }
-        }
-        return count;
+        if (catId == "all") return unreadCounts_.total();
+        if (catId == "saved") return unreadCounts_.saved();
+        return unreadCounts_.category(catId);
     };
     
     // Helper to add category row with optional expansion
@@ -373,19 +705,33 @@ void RSSPanel::updateSidebar() {
         }), nullptr);
         gtk_box_append(GTK_BOX(row), labelBtn);
         
+        // Spinner while any of the category's feeds is still downloading,
+        // so collapsed categories show progress too
+        bool loading = false;
+        for (const auto& f : *feeds) {
+            if (!f.enabled || (cat.id != "all" && f.category != cat.id)) continue;
+            auto load = feedLoad_.find(f.name);
+            if (load != feedLoad_.end() && load->second == FeedLoad::Loading) loading = true;
+        }
+        if (loading) {
+            GtkWidget* spinner = gtk_spinner_new();
+            gtk_spinner_start(GTK_SPINNER(spinner));
+            gtk_box_append(GTK_BOX(row), spinner);
+        }
+        
         // Unread count badge
         int count = countUnreadForCategory(cat.id);
-        if (count > 0) {
-            GtkWidget* badge = gtk_label_new(std::to_string(count).c_str());
-            gtk_widget_add_css_class(badge, "badge");
-            gtk_box_append(GTK_BOX(row), badge);
-        }
+        GtkWidget* badge = gtk_label_new(std::to_string(count).c_str());
+        gtk_widget_add_css_class(badge, "badge");
+        gtk_widget_set_visible(badge, count > 0);
+        gtk_box_append(GTK_BOX(row), badge);
+        categoryBadges_[cat.id] = badge;
         
         gtk_box_append(GTK_BOX(outerBox), row);
         
         // If expanded, show feeds under this category
         if (canExpand && config.isCategoryExpanded(cat.id)) {
-            for (const auto& f : feeds) {
+            for (const auto& f : *feeds) {
                 if (f.category == cat.id && f.enabled) {
                     GtkWidget* feedRow = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 8);
                     gtk_widget_set_margin_start(feedRow, 48);
@@ -400,65 +746,7 @@ void RSSPanel::updateSidebar() {
                     gtk_widget_add_css_class(faviconImg, "dim-label");
                     gtk_box_append(GTK_BOX(feedRow), faviconImg);
                     
-                    // Load favicon asynchronously if not cached
-                    if (!faviconUrl.empty() && faviconCache.find(faviconUrl) == faviconCache.end()) {
-                        faviconCache[faviconUrl] = nullptr;
-                        std::string url = faviconUrl;
-                        GtkWidget* imgWidget = faviconImg;
-                        g_object_ref(imgWidget);
-                        std::thread([url, imgWidget]() {
-                            CURL* curl = curl_easy_init();
-                            if (curl) {
-                                std::string data;
-                                curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-                                curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
-                                curl_easy_setopt(curl, CURLOPT_WRITEDATA, &data);
-                                curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
-                                curl_easy_setopt(curl, CURLOPT_TIMEOUT, 10L);
-                                curl_easy_setopt(curl, CURLOPT_USERAGENT, "Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36");
-                                if (curl_easy_perform(curl) == CURLE_OK && !data.empty()) {
-                                    GInputStream* stream = g_memory_input_stream_new_from_data(
-                                        g_memdup2(data.data(), data.size()), data.size(), g_free);
-                                    GdkPixbuf* pb = gdk_pixbuf_new_from_stream_at_scale(stream, 16, 16, TRUE, nullptr, nullptr);
-                                    g_object_unref(stream);
-                                    if (pb) {
-                                        faviconCache[url] = pb;
-                                        // Update the widget on the main thread
-                                        auto* updateData = new std::pair<GtkWidget*, GdkPixbuf*>(imgWidget, pb);
-                                        g_idle_add([](gpointer data) -> gboolean {
-                                            auto* p = static_cast<std::pair<GtkWidget*, GdkPixbuf*>*>(data);
-                                            if (GTK_IS_IMAGE(p->first)) {
-G_GNUC_BEGIN_IGNORE_DEPRECATIONS
-                                                GdkTexture* texture = gdk_texture_new_for_pixbuf(p->second);
-G_GNUC_END_IGNORE_DEPRECATIONS
-                                                gtk_image_set_from_paintable(GTK_IMAGE(p->first), GDK_PAINTABLE(texture));
-                                                g_object_unref(texture);
-                                                gtk_widget_remove_css_class(p->first, "dim-label");
-                                            }
-                                            g_object_unref(p->first);
-                                            delete p;
-                                            return G_SOURCE_REMOVE;
-                                        }, updateData);
-                                    } else {
-                                        g_object_unref(imgWidget);
-                                    }
-                                } else {
-                                    g_object_unref(imgWidget);
-                                }
-                                curl_easy_cleanup(curl);
-                            } else {
-                                g_object_unref(imgWidget);
-                            }
-                        }).detach();
-                    } else if (faviconCache.count(faviconUrl) && faviconCache[faviconUrl]) {
-                        // Use cached favicon
-G_GNUC_BEGIN_IGNORE_DEPRECATIONS
-                        GdkTexture* texture = gdk_texture_new_for_pixbuf(faviconCache[faviconUrl]);
-G_GNUC_END_IGNORE_DEPRECATIONS
-                        gtk_image_set_from_paintable(GTK_IMAGE(faviconImg), GDK_PAINTABLE(texture));
-                        g_object_unref(texture);
-                        gtk_widget_remove_css_class(faviconImg, "dim-label");
-                    }
+                    if (!faviconUrl.empty()) loadFavicon(faviconUrl, faviconImg);
                     
                     // Feed name as clickable button
                     GtkWidget* feedBtn = gtk_button_new_with_label(f.name.c_str());
@@ -488,14 +776,28 @@ G_GNUC_END_IGNORE_DEPRECATIONS
                     }), nullptr);
                     gtk_box_append(GTK_BOX(feedRow), feedBtn);
                     
-                    int feedCount = countUnreadForFeed(f.name);
-                    if (feedCount > 0) {
-                        GtkWidget* feedBadge = gtk_label_new(std::to_string(feedCount).c_str());
-                        gtk_widget_add_css_class(feedBadge, "badge");
-                        gtk_widget_add_css_class(feedBadge, "small");
-                        gtk_box_append(GTK_BOX(feedRow), feedBadge);
+                    // Refresh state: a spinner while the feed downloads,
+                    // a warning if it could not be fetched.
+                    auto load = feedLoad_.find(f.name);
+                    if (load != feedLoad_.end() && load->second == FeedLoad::Loading) {
+                        GtkWidget* spinner = gtk_spinner_new();
+                        gtk_spinner_start(GTK_SPINNER(spinner));
+                        gtk_box_append(GTK_BOX(feedRow), spinner);
+                    } else if (load != feedLoad_.end() && load->second == FeedLoad::Failed) {
+                        GtkWidget* warning = gtk_image_new_from_icon_name("dialog-warning-symbolic");
+                        gtk_widget_add_css_class(warning, "warning");
+                        gtk_widget_set_tooltip_text(warning, "Could not fetch this feed");
+                        gtk_box_append(GTK_BOX(feedRow), warning);
                     }
                     
+                    int feedCount = countUnreadForFeed(f.name);
+                    GtkWidget* feedBadge = gtk_label_new(std::to_string(feedCount).c_str());
+                    gtk_widget_add_css_class(feedBadge, "badge");
+                    gtk_widget_add_css_class(feedBadge, "small");
+                    gtk_widget_set_visible(feedBadge, feedCount > 0);
+                    gtk_box_append(GTK_BOX(feedRow), feedBadge);
+                    feedBadges_[f.name] = feedBadge;
+                    
                     gtk_box_append(GTK_BOX(outerBox), feedRow);
                 }
             }
@@ -515,12 +817,13 @@ G_GNUC_END_IGNORE_DEPRECATIONS
     addCategoryRow({"saved", "Saved for Later", "starred-symbolic", 1}, false);
     
     // Add regular categories with expansion
-    for (const auto& cat : config.getCategories()) {
+    auto categories = config.getCategories();
+    for (const auto& cat : *categories) {
         if (cat.id == "all" || cat.id == "saved") continue;
         
         // Check if category has feeds
         bool hasFeeds = false;
-        for (const auto& f : feeds) {
+        for (const auto& f : *feeds) {
             if (f.category == cat.id && f.enabled) { hasFeeds = true; break; }
         }
         
@@ -536,11 +839,12 @@ void RSSPanel::selectCategory(const std::string& categoryId) {
     if (categoryId == "saved") {
         title = "Saved for Later";
     } else if (categoryId != "all") {
-        for (const auto& c : categories) 
+        for (const auto& c : *categories) 
             if (c.id == categoryId) { title = c.name; break; }
     }
     gtk_label_set_text(GTK_LABEL(categoryTitle_), title.c_str());
     loadFeedsForCategory(categoryId);
+    scrollToTop(articlesScrolled_);
 }
 
 void RSSPanel::selectFeed(const std::string& feedName) {
@@ -550,7 +854,7 @@ void RSSPanel::selectFeed(const std::string& feedName) {
     // This fixes the issue where clicking a feed while in "saved" category
     // would only show saved articles from that feed
     auto feeds = Config::getInstance().getFeeds();
-    for (const auto& f : feeds) {
+    for (const auto& f : *feeds) {
         if (f.name == feedName) {
             currentCategory_ = f.category;
             break;
@@ -560,164 +864,523 @@ void RSSPanel::selectFeed(const std::string& feedName) {
     gtk_label_set_text(GTK_LABEL(categoryTitle_), feedName.c_str());
     updateSidebar();  // Update to show selected feed highlighted
     loadFeedsForCategory(currentCategory_);  // Reload with feed filter
+    scrollToTop(articlesScrolled_);
 }
 
 void RSSPanel::loadFeeds() {
-    allItems_.clear();
+    fetchLiveFeeds();
+}
+
+// Last-known items of every enabled feed, from the archive or the feed
+// cache, swapped into articles_ in one go once all have reported. They are
+// dropped if live items got there first.
+void RSSPanel::loadCachedFeeds() {
     auto feeds = Config::getInstance().getFeeds();
+    int enabledCount = 0;
+    for (const auto& f : *feeds) if (f.enabled) enabledCount++;
+    if (enabledCount == 0) return;
+    
+    struct Batch {
+        RSSPanel* panel;
+        int remaining;
+        std::mutex mutex;
+        std::vector<std::vector<RSSItem>> lists;  // one per finished feed
+        std::vector<std::string> listSources;     // feed name of each list
+        ArticleStore articles;                    // built once all have reported
+        SearchIndex index;                        // over articles
+        std::vector<ArticleStore::Index> order;   // of articles, newest first
+    };
+    auto batch = std::make_shared<Batch>();
+    batch->panel = this;
+    batch->remaining = enabledCount;
     
+    RSSService service;
+    for (const auto& f : *feeds) {
+        if (!f.enabled) continue;
+        service.loadCachedFeed(f.url, [batch, fname = f.name](std::vector<RSSItem> items) {
+            {
+                std::lock_guard<std::mutex> lock(batch->mutex);
+                batch->lists.push_back(std::move(items));
+                batch->listSources.push_back(fname);
+                if (--batch->remaining != 0) return;
+                buildArticles(std::move(batch->lists), batch->listSources, batch->articles, batch->index,
+                              batch->order);
+            }
+            UiDispatcher::getInstance().post([batch]() {
+                RSSPanel* panel = batch->panel;
+                if (panel->liveItemsLoaded_) return;
+                panel->articles_ = std::move(batch->articles);
+                panel->searchIndex_ = std::move(batch->index);
+                panel->articleOrder_ = std::move(batch->order);
+                panel->unreadCounts_.rebuild(panel->articles_, panel->articleOrder_, Config::getInstance());
+                panel->updateSidebar();
+                panel->loadFeedsForCategory(panel->currentCategory_);
+            });
+        });
+    }
+}
+
+// One list a live refresh has taken in: a feed's final items, what was on
+// screen for it when the refresh began, or a batch of its partial items.
+struct LiveEntry {
+    std::string source;
+    std::vector<RSSItem> items;     // newest first
+    ArticleStore::Index first = 0;  // store index of items[0]
+    bool live = true;               // false once the feed's final list is in
+};
+
+// Articles with their search index and display order, built from a log of
+// LiveEntry by appending.
+struct LiveSet {
+    ArticleStore articles;
+    SearchIndex index;
+    std::vector<ArticleStore::Index> order;  // live entries' articles, newest first
+    size_t logged = 0;                       // log entries added
+};
+
+static void appendEntry(std::vector<LiveEntry>& log, const std::string& source, std::vector<RSSItem> items) {
+    auto newer = [](const RSSItem& a, const RSSItem& b) { return a.pubTime > b.pubTime; };
+    if (!std::is_sorted(items.begin(), items.end(), newer)) std::stable_sort(items.begin(), items.end(), newer);
+    LiveEntry entry;
+    entry.source = source;
+    entry.items = std::move(items);
+    log.push_back(std::move(entry));
+}
+
+// Add the entries of `log` that `set` has not seen, indexing only those,
+// then order the live ones newest first. Ties go to the earlier entry, as
+// in RSSService::mergeByDate. Every set built from one log adds the same
+// entries in the same order, so an entry's articles have the same indices
+// in each.
+static void buildFromLog(std::vector<LiveEntry>& log, LiveSet& set) {
+    for (; set.logged < log.size(); ++set.logged) {
+        LiveEntry& entry = log[set.logged];
+        entry.first = static_cast<ArticleStore::Index>(set.articles.size());
+        for (const auto& item : entry.items) {
+            ArticleStore::Index i = set.articles.add(item, entry.source);
+            set.index.add(i, item.title, item.description, item.author);
+        }
+    }
+    set.index.prepare();
+
+    struct Head {
+        int64_t time;
+        size_t entry;
+        size_t pos;
+    };
+    auto after = [](const Head& a, const Head& b) {
+        return a.time != b.time ? a.time < b.time : a.entry > b.entry;
+    };
+    std::vector<Head> heap;
+    size_t total = 0;
+    for (size_t e = 0; e < log.size(); ++e) {
+        if (!log[e].live || log[e].items.empty()) continue;
+        heap.push_back({log[e].items[0].pubTime, e, 0});
+        total += log[e].items.size();
+    }
+    std::make_heap(heap.begin(), heap.end(), after);
+    set.order.clear();
+    set.order.reserve(total);
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), after);
+        Head& head = heap.back();
+        const LiveEntry& entry = log[head.entry];
+        set.order.push_back(entry.first + static_cast<ArticleStore::Index>(head.pos));
+        if (++head.pos < entry.items.size()) {
+            head.time = entry.items[head.pos].pubTime;
+            std::push_heap(heap.begin(), heap.end(), after);
+        } else {
+            heap.pop_back();
+        }
+    }
+}
+
+// State of one live refresh, shared between the main thread and the workers
+// that deliver and merge feeds.
+//
+// Articles are only appended while a refresh runs: each build logs the
+// lists that came in since the last one and adds just those to its set.
+// Two sets take turns, one on screen and one being built, so an article is
+// indexed twice per refresh however many builds there are, instead of once
+// per build.
+struct RSSPanel::LiveBatch {
+    static constexpr size_t kNotLogged = SIZE_MAX;
+
+    std::mutex mutex;
+    int remaining = 0;
+    std::map<std::string, std::vector<RSSItem>> done;     // final lists not yet logged
+    std::map<std::string, std::vector<RSSItem>> partial;  // parsed, not yet logged
+    std::set<std::string> previewed;  // feeds with nothing on screen at the start; their partials count
+    std::vector<std::pair<std::string, FeedLoad>> loads;  // status changes not yet shown
+    bool dirty = false;         // inputs changed since the last build began
+    bool building = false;      // a build is running or its result is unclaimed
+    bool progressPosted = false;
+    bool built = false;         // next holds an unclaimed build
+    LiveSet next;               // the set builds go into, handed over when built
+    size_t shownLogged = kNotLogged;  // log entries in the set on screen, if it came from the log
+
+    // Only the running build touches this, or fetchLiveFeeds before the first.
+    std::vector<LiveEntry> log;
+};
+
+// Refresh every enabled feed from the network, showing each feed's items as
+// soon as it answers instead of after the slowest one. Deliveries only mark
+// the batch dirty; onLiveProgress, once per frame at most, claims a finished
+// build and starts the next. Builds run on engine workers, one at a time,
+// so a burst of feeds is merged once.
+void RSSPanel::fetchLiveFeeds() {
+    auto feeds = Config::getInstance().getFeeds();
     int enabledCount = 0;
-    for (const auto& f : feeds) if (f.enabled) enabledCount++;
+    for (const auto& f : *feeds) if (f.enabled) enabledCount++;
     
+    feedLoad_.clear();
     if (enabledCount == 0) {
+        liveBatch_.reset();
+        articles_.clear();
+        articleOrder_.clear();
+        searchIndex_.clear();
+        unreadCounts_.clear();
         updateSidebar();
         loadFeedsForCategory(currentCategory_);
         return;
     }
     
-    auto remaining = std::make_shared<int>(enabledCount);
-    auto mtx = std::make_shared<std::mutex>();
+    auto batch = std::make_shared<LiveBatch>();
+    batch->remaining = enabledCount;
+    for (const auto& f : *feeds) {
+        if (f.enabled) feedLoad_[f.name] = FeedLoad::Loading;
+    }
+    // Feeds keep what is on screen for them until their new items are in;
+    // those with nothing there show what has been parsed so far.
+    std::map<std::string, std::vector<RSSItem>> shown;
+    for (ArticleStore::Index i : articleOrder_) {
+        const std::string& source = articles_.source(i);
+        if (feedLoad_.count(source)) shown[source].push_back(articles_.item(i));
+    }
+    for (const auto& [name, load] : feedLoad_) {
+        if (!shown.count(name)) batch->previewed.insert(name);
+    }
+    for (auto& [name, items] : shown) appendEntry(batch->log, name, std::move(items));
+    liveBatch_ = batch;  // a refresh still running is abandoned
+    updateSidebar();
+    
+    auto notify = [this](const std::shared_ptr<LiveBatch>& b) {
+        UiDispatcher::getInstance().post([this, b]() { onLiveProgress(b); });
+    };
     
     RSSService service;
-    for (const auto& f : feeds) {
+    for (const auto& f : *feeds) {
         if (!f.enabled) continue;
-        service.fetchFeed(f.url, [this, fname = f.name, remaining, mtx](std::vector<RSSItem> items) {
+        // The archive adds this fetch to the feed's history; a failed
+        // fetch still shows what was seen before.
+        auto onItems = [batch, notify, fname = f.name, furl = f.url](std::vector<RSSItem> items, bool ok) {
+            FeedLoad load = ok ? FeedLoad::Loaded : FeedLoad::Failed;
+            items = ArticleArchive::getInstance().merge(furl, items);
+            bool last = false;
+            bool post = false;
             {
-                std::lock_guard<std::mutex> lock(*mtx);
-                for (auto& item : items) {
-                    item.source = fname;
-                    allItems_.push_back(item);
-                }
-                (*remaining)--;
+                std::lock_guard<std::mutex> lock(batch->mutex);
+                batch->done[fname] = std::move(items);
+                batch->partial.erase(fname);
+                batch->previewed.erase(fname);
+                batch->loads.emplace_back(fname, load);
+                batch->dirty = true;
+                last = --batch->remaining == 0;
+                post = !std::exchange(batch->progressPosted, true);
             }
-            
-            if (*remaining == 0) {
-                g_idle_add(+[](gpointer data) -> gboolean {
-                    auto* panel = static_cast<RSSPanel*>(data);
-                    panel->updateSidebar();
-                    panel->loadFeedsForCategory(panel->currentCategory_);
-                    return G_SOURCE_REMOVE;
-                }, this);
+            if (last) ArticleArchive::getInstance().flush();
+            if (post) notify(batch);
+        };
+        auto onPartial = [batch, notify, fname = f.name](std::vector<RSSItem> items) {
+            {
+                std::lock_guard<std::mutex> lock(batch->mutex);
+                if (!batch->previewed.count(fname)) return;
+                auto& pending = batch->partial[fname];
+                pending.insert(pending.end(), std::make_move_iterator(items.begin()),
+                               std::make_move_iterator(items.end()));
+                batch->dirty = true;
+                if (std::exchange(batch->progressPosted, true)) return;
             }
-        });
+            notify(batch);
+        };
+        service.fetchFeed(f.url, onItems, onPartial);
     }
 }
 
-void RSSPanel::loadFeedsForCategory(const std::string& categoryId) {
-    auto& config = Config::getInstance();
-    bool isListMode = config.getLayoutMode() == LayoutMode::List;
+void RSSPanel::onLiveProgress(const std::shared_ptr<LiveBatch>& batch) {
+    if (batch != liveBatch_) return;  // superseded by a newer refresh
+    
+    std::vector<std::pair<std::string, FeedLoad>> loads;
+    bool claimed = false;
+    bool startBuild = false;
+    bool finished = false;
+    {
+        std::lock_guard<std::mutex> lock(batch->mutex);
+        batch->progressPosted = false;
+        loads.swap(batch->loads);
+        if (batch->built) {
+            // The set going off screen is built into next time, unless it
+            // predates the refresh; then the next build starts afresh.
+            LiveSet shown{std::move(articles_), std::move(searchIndex_), std::move(articleOrder_),
+                          batch->shownLogged};
+            articles_ = std::move(batch->next.articles);
+            searchIndex_ = std::move(batch->next.index);
+            articleOrder_ = std::move(batch->next.order);
+            batch->shownLogged = batch->next.logged;
+            batch->next = shown.logged == LiveBatch::kNotLogged ? LiveSet{} : std::move(shown);
+            batch->built = false;
+            batch->building = false;
+            claimed = true;
+        }
+        if (batch->dirty && !batch->building) {
+            batch->dirty = false;
+            batch->building = true;
+            startBuild = true;
+        }
+        finished = batch->remaining == 0 && !batch->dirty && !batch->building;
+    }
+    for (auto& [name, load] : loads) feedLoad_[name] = load;
     
-    // Recreate the container based on layout mode
-    if (articlesContainer_) {
-        gtk_scrolled_window_set_child(GTK_SCROLLED_WINDOW(articlesScrolled_), nullptr);
+    if (claimed) {
+        liveItemsLoaded_ = true;
+        unreadCounts_.rebuild(articles_, articleOrder_, Config::getInstance());
+        loadFeedsForCategory(currentCategory_);
     }
     
-    if (isListMode) {
-        // List layout uses GtkListBox
-        articlesContainer_ = gtk_list_box_new();
-        gtk_list_box_set_selection_mode(GTK_LIST_BOX(articlesContainer_), GTK_SELECTION_NONE);
-        gtk_widget_add_css_class(articlesContainer_, "boxed-list");
-        gtk_widget_set_margin_start(articlesContainer_, 16);
-        gtk_widget_set_margin_end(articlesContainer_, 16);
-        gtk_widget_set_margin_top(articlesContainer_, 16);
-        gtk_widget_set_margin_bottom(articlesContainer_, 16);
-    } else {
-        // Cards layout uses GtkFlowBox
-        articlesContainer_ = gtk_flow_box_new();
-        gtk_flow_box_set_selection_mode(GTK_FLOW_BOX(articlesContainer_), GTK_SELECTION_NONE);
-        gtk_flow_box_set_homogeneous(GTK_FLOW_BOX(articlesContainer_), TRUE);
-        gtk_flow_box_set_min_children_per_line(GTK_FLOW_BOX(articlesContainer_), 1);
-        gtk_flow_box_set_max_children_per_line(GTK_FLOW_BOX(articlesContainer_), 4);
-        gtk_flow_box_set_column_spacing(GTK_FLOW_BOX(articlesContainer_), 16);
-        gtk_flow_box_set_row_spacing(GTK_FLOW_BOX(articlesContainer_), 16);
-        gtk_widget_set_margin_start(articlesContainer_, 16);
-        gtk_widget_set_margin_end(articlesContainer_, 16);
-        gtk_widget_set_margin_top(articlesContainer_, 16);
-        gtk_widget_set_margin_bottom(articlesContainer_, 16);
+    if (startBuild) {
+        HttpEngine::getInstance().post([this, batch]() {
+            std::map<std::string, std::vector<RSSItem>> done;
+            std::map<std::string, std::vector<RSSItem>> partial;
+            LiveSet set;
+            {
+                std::lock_guard<std::mutex> lock(batch->mutex);
+                done.swap(batch->done);
+                partial.swap(batch->partial);
+                set = std::move(batch->next);
+            }
+            for (auto& [name, items] : done) {
+                for (auto& entry : batch->log) {
+                    if (entry.source == name) entry.live = false;
+                }
+                appendEntry(batch->log, name, std::move(items));
+            }
+            for (auto& [name, items] : partial) appendEntry(batch->log, name, std::move(items));
+            buildFromLog(batch->log, set);
+            {
+                std::lock_guard<std::mutex> lock(batch->mutex);
+                batch->next = std::move(set);
+                batch->built = true;
+                if (std::exchange(batch->progressPosted, true)) return;
+            }
+            UiDispatcher::getInstance().post([this, batch]() { onLiveProgress(batch); });
+        });
     }
     
-    gtk_scrolled_window_set_child(GTK_SCROLLED_WINDOW(articlesScrolled_), articlesContainer_);
+    if (!loads.empty() || claimed) updateSidebar();
+    
+    if (finished) {
+        liveBatch_.reset();
+        // Keeps read marks of articles still in feeds from expiring.
+        std::vector<std::string_view> links;
+        links.reserve(articleOrder_.size());
+        for (ArticleStore::Index i : articleOrder_) links.push_back(articles_.link(i));
+        Config::getInstance().noteArticlesSeen(links);
+        resolveArticleImages();
+        logImageCacheStats();
+    }
+}
+
+// Look up lead images for items whose feed entry had none. Results arrive
+// one page at a time; those landing within a short window are handed to the
+// main thread together, and only the articles they belong to are updated.
+void RSSPanel::resolveArticleImages() {
+    struct Pending {
+        std::mutex mutex;
+        std::map<std::string, std::string> images;  // article link -> image URL
+        bool scheduled = false;
+    };
+    auto pending = std::make_shared<Pending>();
+
+    std::vector<std::string> links;
+    for (ArticleStore::Index i : articleOrder_) {
+        if (articles_.imageUrl(i).empty() && !articles_.link(i).empty()) {
+            links.emplace_back(articles_.link(i));
+        }
+    }
+
+    RSSService service;
+    service.resolveImages(links, [this, pending](std::string link, std::string imageUrl) {
+        {
+            std::lock_guard<std::mutex> lock(pending->mutex);
+            pending->images[std::move(link)] = std::move(imageUrl);
+            if (pending->scheduled) return;
+            pending->scheduled = true;
+        }
+        UiDispatcher::getInstance().postAfter(kImageWindowMs, [this, pending]() {
+            std::map<std::string, std::string> images;
+            {
+                std::lock_guard<std::mutex> lock(pending->mutex);
+                images.swap(pending->images);
+                pending->scheduled = false;
+            }
+            // Looked up by link: a refresh may have rebuilt the store since.
+            for (const auto& [link, imageUrl] : images) {
+                ArticleStore::Index i = articles_.findLink(link);
+                if (i == ArticleStore::kNoId || !articles_.imageUrl(i).empty()) continue;
+                articles_.setImageUrl(i, imageUrl);
+                auto bound = boundWidgets_.find(i);
+                if (bound != boundWidgets_.end()) showArticleImage(bound->second, imageUrl);
+            }
+        });
+    });
+}
+
+void RSSPanel::loadFeedsForCategory(const std::string& categoryId) {
+    auto& config = Config::getInstance();
+    showArticleView(config.getLayoutMode() == LayoutMode::List);
     
     auto feeds = config.getFeeds();
     
-    // Helper lambda to add article based on layout
-    auto addArticle = [this, isListMode](const RSSItem& item) {
-        if (isListMode) {
-            addArticleListItem(item);
-        } else {
-            addArticleCard(item);
-        }
-    };
+    bool searching = !searchQuery_.empty();
+    bool savedView = categoryId == "saved" && currentFeed_.empty();
     
-    // If a specific feed is selected, show ALL articles from that feed
-    // regardless of what category we're viewing (fixes "Saved for Later" then click feed issue)
-    if (!currentFeed_.empty()) {
-        for (const auto& item : allItems_) {
-            if (item.source == currentFeed_) {
-                addArticle(item);
-            }
-        }
-        return;
+    // Articles a refresh has since replaced are still in the store and
+    // indexed; anything found other than through articleOrder_ is checked
+    // against this.
+    std::vector<bool> shown;
+    if ((searching || savedView) && articleOrder_.size() != articles_.size()) {
+        shown.resize(articles_.size());
+        for (ArticleStore::Index i : articleOrder_) shown[i] = true;
     }
-    
-    // Handle "Saved for Later" category
-    if (categoryId == "saved") {
-        auto savedArticles = config.getSavedArticles();
-        for (const auto& item : allItems_) {
-            if (savedArticles.count(item.link)) {
-                addArticle(item);
-            }
-        }
-        return;
+    auto isShown = [&shown](ArticleStore::Index i) { return shown.empty() || shown[i]; };
+    
+    // A search narrows whatever is selected to its matches, best first.
+    std::vector<ArticleStore::Index> order;
+    if (searching) {
+        order = searchIndex_.search(searchQuery_);
+        std::erase_if(order, [&isShown](ArticleStore::Index i) { return !isShown(i); });
+    } else if (!savedView) {
+        order = articleOrder_;
     }
     
-    // Show articles for the selected category
-    for (const auto& item : allItems_) {
-        bool show = false;
-        if (categoryId == "all") {
-            show = true;
+    std::vector<ArticleStore::Index> visible;
+    visible.reserve(order.size());
+    if (!currentFeed_.empty()) {
+        // If a specific feed is selected, show ALL articles from that feed
+        // regardless of what category we're viewing (fixes "Saved for Later" then click feed issue)
+        uint32_t source = articles_.findSource(currentFeed_);
+        for (ArticleStore::Index i : order) {
+            if (articles_.sourceId(i) == source) visible.push_back(i);
+        }
+    } else if (categoryId == "saved") {
+        // Saved links are few: look each one up rather than test every article.
+        std::vector<ArticleStore::Index> saved;
+        for (const auto& link : config.getSavedArticles()) {
+            ArticleStore::Index i = articles_.findLink(link);
+            if (i != ArticleStore::kNoId && isShown(i)) saved.push_back(i);
+        }
+        if (searching) {
+            std::sort(saved.begin(), saved.end());
+            for (ArticleStore::Index i : order) {
+                if (std::binary_search(saved.begin(), saved.end(), i)) visible.push_back(i);
+            }
         } else {
-            for (const auto& f : feeds) {
-                if (f.name == item.source && f.category == categoryId && f.enabled) {
-                    show = true;
+            std::sort(saved.begin(), saved.end(), [this](ArticleStore::Index a, ArticleStore::Index b) {
+                int64_t ta = articles_.pubTime(a), tb = articles_.pubTime(b);
+                return ta != tb ? ta > tb : a < b;
+            });
+            visible = std::move(saved);
+        }
+    } else if (categoryId == "all") {
+        visible = std::move(order);
+    } else {
+        for (ArticleStore::Index i : order) {
+            const std::string& source = articles_.source(i);
+            for (const auto& f : *feeds) {
+                if (f.name == source && f.category == categoryId && f.enabled) {
+                    visible.push_back(i);
                     break;
                 }
             }
         }
-        if (show) addArticle(item);
     }
+    
+    // Only the rows on screen get widgets; the view binds them on demand.
+    ArticleListModel::setIndices(articleModel_, std::move(visible));
 }
 
 void RSSPanel::refresh() { loadFeeds(); }
 
-void RSSPanel::markArticleRead(const std::string& articleUrl) {
-    Config::getInstance().markArticleRead(articleUrl);
-    updateSidebar();
-    loadFeedsForCategory(currentCategory_);
+static void setBadge(const std::map<std::string, GtkWidget*>& badges, const std::string& key, int count) {
+    auto it = badges.find(key);
+    if (it == badges.end()) return;
+    gtk_label_set_text(GTK_LABEL(it->second), std::to_string(count).c_str());
+    gtk_widget_set_visible(it->second, count > 0);
 }
 
-void RSSPanel::toggleArticleSaved(const std::string& articleUrl) {
+// Show the current counts on the badges an article counts towards: "All",
+// its feed, and its feed's category.
+void RSSPanel::updateArticleBadges(ArticleStore::Index index) {
+    uint32_t source = articles_.sourceId(index);
+    setBadge(categoryBadges_, "all", unreadCounts_.total());
+    setBadge(feedBadges_, articles_.source(index), unreadCounts_.source(source));
+    if (const std::string* category = unreadCounts_.categoryOf(source)) {
+        setBadge(categoryBadges_, *category, unreadCounts_.category(*category));
+    }
+}
+
+bool RSSPanel::isCurrentArticle(ArticleStore::Index index, const std::string& link) const {
+    return index < articles_.size() && articles_.link(index) == link;
+}
+
+void RSSPanel::setArticleRead(ArticleStore::Index index, bool read) {
     auto& config = Config::getInstance();
-    if (config.isArticleSaved(articleUrl)) {
-        config.unsaveArticle(articleUrl);
+    std::string link(articles_.link(index));
+    if (config.isArticleRead(link) == read) return;
+    if (read) {
+        config.markArticleRead(link);
     } else {
-        config.saveArticle(articleUrl);
+        config.markArticleUnread(link);
     }
-    updateSidebar();
+    auto it = boundWidgets_.find(index);
+    if (it != boundWidgets_.end()) setCssClass(it->second, "read", read);
+    unreadCounts_.setRead(articles_, index, read);
+    updateArticleBadges(index);
+}
+
+void RSSPanel::toggleArticleSaved(ArticleStore::Index index) {
+    auto& config = Config::getInstance();
+    std::string link(articles_.link(index));
+    bool saved = !config.isArticleSaved(link);
+    if (saved) {
+        config.saveArticle(link);
+    } else {
+        config.unsaveArticle(link);
+    }
+    auto it = boundWidgets_.find(index);
+    if (it != boundWidgets_.end()) {
+        setCssClass(it->second, "saved", saved);
+        gtk_widget_set_visible(static_cast<GtkWidget*>(g_object_get_data(G_OBJECT(it->second), "star")), saved);
+    }
+    unreadCounts_.setSaved(saved);
+    setBadge(categoryBadges_, "saved", unreadCounts_.saved());
+    // The saved view has to gain or lose the article itself.
     if (currentCategory_ == "saved") {
         loadFeedsForCategory(currentCategory_);
     }
 }
 
-// Context menu data structure
+// Context menu data structure. The link guards against the store having
+// been replaced by a refresh while the menu was open.
 struct ContextMenuData {
     RSSPanel* panel;
+    ArticleStore::Index index;
     std::string articleUrl;
     GtkWidget* popover;
-    GtkWidget* card;
 };
 
-void RSSPanel::showArticleContextMenu(GtkWidget* widget, const RSSItem& item, double x, double y) {
+void RSSPanel::showArticleContextMenu(GtkWidget* widget, ArticleStore::Index index, double x, double y) {
+    std::string link(articles_.link(index));
     GtkWidget* popover = gtk_popover_new();
     gtk_widget_set_parent(popover, widget);
     
@@ -728,34 +1391,24 @@ void RSSPanel::showArticleContextMenu(GtkWidget* widget, const RSSItem& item, do
     gtk_widget_set_margin_bottom(box, 4);
     
     auto& config = Config::getInstance();
-    bool isRead = config.isArticleRead(item.link);
-    bool isSaved = config.isArticleSaved(item.link);
+    bool isRead = config.isArticleRead(link);
+    bool isSaved = config.isArticleSaved(link);
     
     // Mark as Read/Unread button
     GtkWidget* readBtn = gtk_button_new_with_label(isRead ? "Mark as Unread" : "Mark as Read");
     gtk_widget_add_css_class(readBtn, "flat");
     gtk_box_append(GTK_BOX(box), readBtn);
     
-    auto* readData = new ContextMenuData{this, item.link, popover, widget};
+    auto* readData = new ContextMenuData{this, index, link, popover};
     g_object_set_data_full(G_OBJECT(readBtn), "data", readData, 
         [](gpointer d) { delete static_cast<ContextMenuData*>(d); });
     g_signal_connect(readBtn, "clicked", G_CALLBACK(+[](GtkButton* btn, gpointer) {
         auto* data = static_cast<ContextMenuData*>(g_object_get_data(G_OBJECT(btn), "data"));
         if (!data) return;
-        auto& cfg = Config::getInstance();
-        if (cfg.isArticleRead(data->articleUrl)) {
-            cfg.markArticleUnread(data->articleUrl);
-        } else {
-            cfg.markArticleRead(data->articleUrl);
-        }
         gtk_popover_popdown(GTK_POPOVER(data->popover));
-        // Update the card appearance
-        if (cfg.isArticleRead(data->articleUrl)) {
-            gtk_widget_add_css_class(data->card, "read");
-        } else {
-            gtk_widget_remove_css_class(data->card, "read");
-        }
-        data->panel->updateSidebar();
+        if (!data->panel->isCurrentArticle(data->index, data->articleUrl)) return;
+        bool read = Config::getInstance().isArticleRead(data->articleUrl);
+        data->panel->setArticleRead(data->index, !read);
     }), nullptr);
     
     // Save for Later button
@@ -763,14 +1416,15 @@ void RSSPanel::showArticleContextMenu(GtkWidget* widget, const RSSItem& item, do
     gtk_widget_add_css_class(saveBtn, "flat");
     gtk_box_append(GTK_BOX(box), saveBtn);
     
-    auto* saveData = new ContextMenuData{this, item.link, popover, widget};
+    auto* saveData = new ContextMenuData{this, index, link, popover};
     g_object_set_data_full(G_OBJECT(saveBtn), "data", saveData,
         [](gpointer d) { delete static_cast<ContextMenuData*>(d); });
     g_signal_connect(saveBtn, "clicked", G_CALLBACK(+[](GtkButton* btn, gpointer) {
         auto* data = static_cast<ContextMenuData*>(g_object_get_data(G_OBJECT(btn), "data"));
         if (!data) return;
-        data->panel->toggleArticleSaved(data->articleUrl);
         gtk_popover_popdown(GTK_POPOVER(data->popover));
+        if (!data->panel->isCurrentArticle(data->index, data->articleUrl)) return;
+        data->panel->toggleArticleSaved(data->index);
     }), nullptr);
     
     // Open in Browser button
@@ -778,7 +1432,7 @@ void RSSPanel::showArticleContextMenu(GtkWidget* widget, const RSSItem& item, do
     gtk_widget_add_css_class(openBtn, "flat");
     gtk_box_append(GTK_BOX(box), openBtn);
     
-    char* urlCopy = g_strdup(item.link.c_str());
+    char* urlCopy = g_strdup(link.c_str());
     g_object_set_data_full(G_OBJECT(openBtn), "url", urlCopy, g_free);
     g_object_set_data(G_OBJECT(openBtn), "popover", popover);
     g_signal_connect(openBtn, "clicked", G_CALLBACK(+[](GtkButton* btn, gpointer) {
@@ -798,86 +1452,71 @@ void RSSPanel::showArticleContextMenu(GtkWidget* widget, const RSSItem& item, do
     gtk_popover_popup(GTK_POPOVER(popover));
 }
 
-void RSSPanel::addArticleCard(const RSSItem& item) {
-    bool isRead = Config::getInstance().isArticleRead(item.link);
-    bool isSaved = Config::getInstance().isArticleSaved(item.link);
-    
-    GtkWidget* card = gtk_box_new(GTK_ORIENTATION_VERTICAL, 0);
-    gtk_widget_add_css_class(card, "card");
-    gtk_widget_set_size_request(card, 280, 320);
-    if (isRead) gtk_widget_add_css_class(card, "read");
-    if (isSaved) gtk_widget_add_css_class(card, "saved");
+void RSSPanel::attachArticleGestures(GtkWidget* root, GtkListItem* listItem) {
+    g_object_set_data(G_OBJECT(root), "list-item", listItem);
+    g_object_set_data(G_OBJECT(root), "panel", this);
     
     // Right-click gesture for context menu
     GtkGesture* rightClick = gtk_gesture_click_new();
     gtk_gesture_single_set_button(GTK_GESTURE_SINGLE(rightClick), GDK_BUTTON_SECONDARY);
-    
-    // Store item data for context menu
-    auto* itemData = new RSSItem(item);
-    g_object_set_data_full(G_OBJECT(card), "item-data", itemData,
-        [](gpointer d) { delete static_cast<RSSItem*>(d); });
-    g_object_set_data(G_OBJECT(card), "panel", this);
-    
-    g_signal_connect(rightClick, "pressed", G_CALLBACK(+[](GtkGestureClick* gesture, gint, gdouble x, gdouble y, gpointer userData) {
-        GtkWidget* card = static_cast<GtkWidget*>(userData);
-        RSSItem* item = static_cast<RSSItem*>(g_object_get_data(G_OBJECT(card), "item-data"));
-        RSSPanel* panel = static_cast<RSSPanel*>(g_object_get_data(G_OBJECT(card), "panel"));
-        if (item && panel) {
-            panel->showArticleContextMenu(card, *item, x, y);
+    g_signal_connect(rightClick, "pressed", G_CALLBACK(+[](GtkGestureClick*, gint, gdouble x, gdouble y, gpointer userData) {
+        GtkWidget* root = static_cast<GtkWidget*>(userData);
+        RSSPanel* panel = static_cast<RSSPanel*>(g_object_get_data(G_OBJECT(root), "panel"));
+        ArticleStore::Index i = boundArticle(root);
+        if (panel && i < panel->articles_.size()) {
+            panel->showArticleContextMenu(root, i, x, y);
         }
-    }), card);
-    gtk_widget_add_controller(card, GTK_EVENT_CONTROLLER(rightClick));
-    
-    if (!item.imageUrl.empty()) {
-        GtkWidget* imageArea = gtk_drawing_area_new();
-        gtk_widget_set_size_request(imageArea, 280, 160);
-        gtk_drawing_area_set_draw_func(GTK_DRAWING_AREA(imageArea), onDrawImage, nullptr, nullptr);
-        char* urlCopy = g_strdup(item.imageUrl.c_str());
-        g_object_set_data_full(G_OBJECT(imageArea), "image-url", urlCopy, g_free);
-        gtk_box_append(GTK_BOX(card), imageArea);
+    }), root);
+    gtk_widget_add_controller(root, GTK_EVENT_CONTROLLER(rightClick));
+    
+    // Left click gesture for opening article
+    GtkGesture* leftClick = gtk_gesture_click_new();
+    gtk_gesture_single_set_button(GTK_GESTURE_SINGLE(leftClick), GDK_BUTTON_PRIMARY);
+    g_signal_connect(leftClick, "pressed", G_CALLBACK(+[](GtkGestureClick*, gint, gdouble, gdouble, gpointer userData) {
+        GtkWidget* root = static_cast<GtkWidget*>(userData);
+        RSSPanel* panel = static_cast<RSSPanel*>(g_object_get_data(G_OBJECT(root), "panel"));
+        ArticleStore::Index i = boundArticle(root);
+        if (!panel || i >= panel->articles_.size()) return;
+        std::string link(panel->articles_.link(i));
+        panel->setArticleRead(i, true);
         
-        if (imageCache.find(item.imageUrl) == imageCache.end()) {
-            imageCache[item.imageUrl] = {nullptr, 0, 0};
-            std::string imgUrl = item.imageUrl;
-            std::thread([imgUrl]() {
-                CURL* curl = curl_easy_init();
-                if (curl) {
-                    std::string data;
-                    curl_easy_setopt(curl, CURLOPT_URL, imgUrl.c_str());
-                    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
-                    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &data);
-                    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
-                    curl_easy_setopt(curl, CURLOPT_TIMEOUT, 10L);
-                    if (curl_easy_perform(curl) == CURLE_OK && !data.empty()) {
-                        GInputStream* stream = g_memory_input_stream_new_from_data(
-                            g_memdup2(data.data(), data.size()), data.size(), g_free);
-                        GdkPixbuf* pb = gdk_pixbuf_new_from_stream(stream, nullptr, nullptr);
-                        g_object_unref(stream);
-                        if (pb) {
-                            std::string url = imgUrl;
-                            g_idle_add([](gpointer data) -> gboolean {
-                                auto* p = static_cast<std::pair<std::string, GdkPixbuf*>*>(data);
-                                imageCache[p->first] = {p->second, gdk_pixbuf_get_width(p->second),
-                                                        gdk_pixbuf_get_height(p->second)};
-                                delete p;
-                                return FALSE;
-                            }, new std::pair<std::string, GdkPixbuf*>(url, pb));
-                        }
-                    }
-                    curl_easy_cleanup(curl);
-                }
-            }).detach();
-        }
-    } else {
-        GtkWidget* placeholder = gtk_box_new(GTK_ORIENTATION_VERTICAL, 8);
-        gtk_widget_set_size_request(placeholder, 280, 100);
-        gtk_widget_set_valign(placeholder, GTK_ALIGN_CENTER);
-        GtkWidget* icon = gtk_image_new_from_icon_name("application-rss+xml-symbolic");
-        gtk_image_set_pixel_size(GTK_IMAGE(icon), 48);
-        gtk_widget_add_css_class(icon, "dim-label");
-        gtk_box_append(GTK_BOX(placeholder), icon);
-        gtk_box_append(GTK_BOX(card), placeholder);
-    }
+        std::string cmd = "xdg-open '" + link + "'";
+        system(cmd.c_str());
+    }), root);
+    gtk_widget_add_controller(root, GTK_EVENT_CONTROLLER(leftClick));
+}
+
+// A picture coming on screen may now be nearer than what is queued.
+static void onArticlePictureMapped(GtkWidget*, gpointer) {
+    schedulePumpImageLoads();
+}
+
+// Cards and list rows are built once per recycled widget and filled in by
+// onArticleBind for whichever article the view assigns; bind finds the
+// parts it updates through data set on the root widget.
+void RSSPanel::onCardSetup(GtkSignalListItemFactory*, GtkListItem* listItem, gpointer userData) {
+    auto* panel = static_cast<RSSPanel*>(userData);
+    
+    GtkWidget* card = gtk_box_new(GTK_ORIENTATION_VERTICAL, 0);
+    gtk_widget_add_css_class(card, "card");
+    gtk_widget_set_size_request(card, 280, 320);
+    
+    GtkWidget* imageArea = gtk_picture_new();
+    gtk_widget_set_size_request(imageArea, 280, 160);
+    gtk_picture_set_content_fit(GTK_PICTURE(imageArea), GTK_CONTENT_FIT_CONTAIN);
+    gtk_picture_set_can_shrink(GTK_PICTURE(imageArea), TRUE);
+    gtk_widget_add_css_class(imageArea, "article-image");
+    g_signal_connect(imageArea, "map", G_CALLBACK(onArticlePictureMapped), nullptr);
+    gtk_box_append(GTK_BOX(card), imageArea);
+    
+    GtkWidget* placeholder = gtk_box_new(GTK_ORIENTATION_VERTICAL, 8);
+    gtk_widget_set_size_request(placeholder, 280, 100);
+    gtk_widget_set_valign(placeholder, GTK_ALIGN_CENTER);
+    GtkWidget* icon = gtk_image_new_from_icon_name("application-rss+xml-symbolic");
+    gtk_image_set_pixel_size(GTK_IMAGE(icon), 48);
+    gtk_widget_add_css_class(icon, "dim-label");
+    gtk_box_append(GTK_BOX(placeholder), icon);
+    gtk_box_append(GTK_BOX(card), placeholder);
     
     GtkWidget* contentBox = gtk_box_new(GTK_ORIENTATION_VERTICAL, 8);
     gtk_widget_set_margin_start(contentBox, 12);
@@ -888,13 +1527,11 @@ void RSSPanel::addArticleCard(const RSSItem& item) {
     
     // Title with saved indicator
     GtkWidget* titleBox = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 6);
-    if (isSaved) {
-        GtkWidget* star = gtk_image_new_from_icon_name("starred-symbolic");
-        gtk_widget_add_css_class(star, "accent");
-        gtk_box_append(GTK_BOX(titleBox), star);
-    }
+    GtkWidget* star = gtk_image_new_from_icon_name("starred-symbolic");
+    gtk_widget_add_css_class(star, "accent");
+    gtk_box_append(GTK_BOX(titleBox), star);
     
-    GtkWidget* titleLabel = gtk_label_new(item.title.c_str());
+    GtkWidget* titleLabel = gtk_label_new(nullptr);
     gtk_widget_add_css_class(titleLabel, "heading");
     gtk_label_set_wrap(GTK_LABEL(titleLabel), TRUE);
     gtk_label_set_max_width_chars(GTK_LABEL(titleLabel), 35);
@@ -905,33 +1542,21 @@ void RSSPanel::addArticleCard(const RSSItem& item) {
     gtk_box_append(GTK_BOX(titleBox), titleLabel);
     gtk_box_append(GTK_BOX(contentBox), titleBox);
     
-    if (!item.description.empty()) {
-        std::string desc = item.description.substr(0, 150);
-        size_t lt = desc.find('<');
-        while (lt != std::string::npos) {
-            size_t gt = desc.find('>', lt);
-            if (gt != std::string::npos) desc.erase(lt, gt - lt + 1);
-            else break;
-            lt = desc.find('<');
-        }
-        if (!desc.empty()) {
-            GtkWidget* descLabel = gtk_label_new(desc.c_str());
-            gtk_widget_add_css_class(descLabel, "dim-label");
-            gtk_label_set_wrap(GTK_LABEL(descLabel), TRUE);
-            gtk_label_set_max_width_chars(GTK_LABEL(descLabel), 40);
-            gtk_label_set_lines(GTK_LABEL(descLabel), 3);
-            gtk_label_set_ellipsize(GTK_LABEL(descLabel), PANGO_ELLIPSIZE_END);
-            gtk_label_set_xalign(GTK_LABEL(descLabel), 0);
-            gtk_box_append(GTK_BOX(contentBox), descLabel);
-        }
-    }
+    GtkWidget* descLabel = gtk_label_new(nullptr);
+    gtk_widget_add_css_class(descLabel, "dim-label");
+    gtk_label_set_wrap(GTK_LABEL(descLabel), TRUE);
+    gtk_label_set_max_width_chars(GTK_LABEL(descLabel), 40);
+    gtk_label_set_lines(GTK_LABEL(descLabel), 3);
+    gtk_label_set_ellipsize(GTK_LABEL(descLabel), PANGO_ELLIPSIZE_END);
+    gtk_label_set_xalign(GTK_LABEL(descLabel), 0);
+    gtk_box_append(GTK_BOX(contentBox), descLabel);
     
     GtkWidget* spacer = gtk_box_new(GTK_ORIENTATION_VERTICAL, 0);
     gtk_widget_set_vexpand(spacer, TRUE);
     gtk_box_append(GTK_BOX(contentBox), spacer);
     
     GtkWidget* metaBox = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 8);
-    GtkWidget* sourceLabel = gtk_label_new(item.source.c_str());
+    GtkWidget* sourceLabel = gtk_label_new(nullptr);
     gtk_widget_add_css_class(sourceLabel, "dim-label");
     gtk_widget_add_css_class(sourceLabel, "caption");
     gtk_label_set_ellipsize(GTK_LABEL(sourceLabel), PANGO_ELLIPSIZE_END);
@@ -939,48 +1564,30 @@ void RSSPanel::addArticleCard(const RSSItem& item) {
     gtk_label_set_xalign(GTK_LABEL(sourceLabel), 0);
     gtk_box_append(GTK_BOX(metaBox), sourceLabel);
     
-    if (!item.pubDate.empty()) {
-        std::string date = item.pubDate;
-        if (date.length() > 16) date = date.substr(0, 16);
-        GtkWidget* dateLabel = gtk_label_new(date.c_str());
-        gtk_widget_add_css_class(dateLabel, "dim-label");
-        gtk_widget_add_css_class(dateLabel, "caption");
-        gtk_box_append(GTK_BOX(metaBox), dateLabel);
-    }
+    GtkWidget* dateLabel = gtk_label_new(nullptr);
+    gtk_widget_add_css_class(dateLabel, "dim-label");
+    gtk_widget_add_css_class(dateLabel, "caption");
+    gtk_box_append(GTK_BOX(metaBox), dateLabel);
     gtk_box_append(GTK_BOX(contentBox), metaBox);
     gtk_box_append(GTK_BOX(card), contentBox);
     
-    // Left click gesture for opening article
-    GtkGesture* leftClick = gtk_gesture_click_new();
-    gtk_gesture_single_set_button(GTK_GESTURE_SINGLE(leftClick), GDK_BUTTON_PRIMARY);
-    char* linkCopy = g_strdup(item.link.c_str());
-    g_object_set_data_full(G_OBJECT(leftClick), "link", linkCopy, g_free);
-    g_object_set_data(G_OBJECT(leftClick), "card", card);
-    g_object_set_data(G_OBJECT(leftClick), "panel", this);
-    g_signal_connect(leftClick, "pressed", G_CALLBACK(+[](GtkGestureClick*, gint, gdouble, gdouble, gpointer userData) {
-        GtkGesture* gesture = static_cast<GtkGesture*>(userData);
-        const char* link = static_cast<const char*>(g_object_get_data(G_OBJECT(gesture), "link"));
-        GtkWidget* card = static_cast<GtkWidget*>(g_object_get_data(G_OBJECT(gesture), "card"));
-        RSSPanel* panel = static_cast<RSSPanel*>(g_object_get_data(G_OBJECT(gesture), "panel"));
-        if (link) {
-            // Mark as read and update appearance
-            Config::getInstance().markArticleRead(link);
-            gtk_widget_add_css_class(card, "read");
-            if (panel) panel->updateSidebar();
-            
-            std::string cmd = "xdg-open '" + std::string(link) + "'";
-            system(cmd.c_str());
-        }
-    }), leftClick);
-    gtk_widget_add_controller(card, GTK_EVENT_CONTROLLER(leftClick));
-    
-    gtk_flow_box_append(GTK_FLOW_BOX(articlesContainer_), card);
+    g_object_set_data(G_OBJECT(card), "image", imageArea);
+    g_object_set_data(G_OBJECT(card), "placeholder", placeholder);
+    g_object_set_data(G_OBJECT(card), "star", star);
+    g_object_set_data(G_OBJECT(card), "title", titleLabel);
+    g_object_set_data(G_OBJECT(card), "desc", descLabel);
+    g_object_set_data(G_OBJECT(card), "desc-limit", GUINT_TO_POINTER(150));
+    g_object_set_data(G_OBJECT(card), "source", sourceLabel);
+    g_object_set_data(G_OBJECT(card), "date", dateLabel);
+    panel->attachArticleGestures(card, listItem);
+    
+    gtk_list_item_set_activatable(listItem, FALSE);
+    gtk_list_item_set_child(listItem, card);
 }
 
 // List layout item - horizontal layout like Feedly
-void RSSPanel::addArticleListItem(const RSSItem& item) {
-    bool isRead = Config::getInstance().isArticleRead(item.link);
-    bool isSaved = Config::getInstance().isArticleSaved(item.link);
+void RSSPanel::onListRowSetup(GtkSignalListItemFactory*, GtkListItem* listItem, gpointer userData) {
+    auto* panel = static_cast<RSSPanel*>(userData);
     
     // Main row container
     GtkWidget* row = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 12);
@@ -989,83 +1596,27 @@ void RSSPanel::addArticleListItem(const RSSItem& item) {
     gtk_widget_set_margin_end(row, 12);
     gtk_widget_set_margin_top(row, 8);
     gtk_widget_set_margin_bottom(row, 8);
-    if (isRead) gtk_widget_add_css_class(row, "read");
-    if (isSaved) gtk_widget_add_css_class(row, "saved");
-    
-    // Right-click gesture for context menu
-    GtkGesture* rightClick = gtk_gesture_click_new();
-    gtk_gesture_single_set_button(GTK_GESTURE_SINGLE(rightClick), GDK_BUTTON_SECONDARY);
-    
-    auto* itemData = new RSSItem(item);
-    g_object_set_data_full(G_OBJECT(row), "item-data", itemData,
-        [](gpointer d) { delete static_cast<RSSItem*>(d); });
-    g_object_set_data(G_OBJECT(row), "panel", this);
-    
-    g_signal_connect(rightClick, "pressed", G_CALLBACK(+[](GtkGestureClick*, gint, gdouble x, gdouble y, gpointer userData) {
-        GtkWidget* row = static_cast<GtkWidget*>(userData);
-        RSSItem* item = static_cast<RSSItem*>(g_object_get_data(G_OBJECT(row), "item-data"));
-        RSSPanel* panel = static_cast<RSSPanel*>(g_object_get_data(G_OBJECT(row), "panel"));
-        if (item && panel) {
-            panel->showArticleContextMenu(row, *item, x, y);
-        }
-    }), row);
-    gtk_widget_add_controller(row, GTK_EVENT_CONTROLLER(rightClick));
     
     // Thumbnail image on the left (small, fixed size)
-    if (!item.imageUrl.empty()) {
-        GtkWidget* imageArea = gtk_drawing_area_new();
-        gtk_widget_set_size_request(imageArea, 100, 70);
-        gtk_drawing_area_set_draw_func(GTK_DRAWING_AREA(imageArea), onDrawImage, nullptr, nullptr);
-        char* urlCopy = g_strdup(item.imageUrl.c_str());
-        g_object_set_data_full(G_OBJECT(imageArea), "image-url", urlCopy, g_free);
-        gtk_box_append(GTK_BOX(row), imageArea);
-        
-        // Load image if not cached
-        if (imageCache.find(item.imageUrl) == imageCache.end()) {
-            imageCache[item.imageUrl] = {nullptr, 0, 0};
-            std::string imgUrl = item.imageUrl;
-            std::thread([imgUrl]() {
-                CURL* curl = curl_easy_init();
-                if (curl) {
-                    std::string data;
-                    curl_easy_setopt(curl, CURLOPT_URL, imgUrl.c_str());
-                    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
-                    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &data);
-                    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
-                    curl_easy_setopt(curl, CURLOPT_TIMEOUT, 10L);
-                    if (curl_easy_perform(curl) == CURLE_OK && !data.empty()) {
-                        GInputStream* stream = g_memory_input_stream_new_from_data(
-                            g_memdup2(data.data(), data.size()), data.size(), g_free);
-                        GdkPixbuf* pb = gdk_pixbuf_new_from_stream(stream, nullptr, nullptr);
-                        g_object_unref(stream);
-                        if (pb) {
-                            std::string url = imgUrl;
-                            g_idle_add([](gpointer data) -> gboolean {
-                                auto* p = static_cast<std::pair<std::string, GdkPixbuf*>*>(data);
-                                imageCache[p->first] = {p->second, gdk_pixbuf_get_width(p->second),
-                                                        gdk_pixbuf_get_height(p->second)};
-                                delete p;
-                                return FALSE;
-                            }, new std::pair<std::string, GdkPixbuf*>(url, pb));
-                        }
-                    }
-                    curl_easy_cleanup(curl);
-                }
-            }).detach();
-        }
-    } else {
-        // Placeholder when no image
-        GtkWidget* placeholder = gtk_box_new(GTK_ORIENTATION_VERTICAL, 0);
-        gtk_widget_set_size_request(placeholder, 100, 70);
-        GtkWidget* icon = gtk_image_new_from_icon_name("application-rss+xml-symbolic");
-        gtk_image_set_pixel_size(GTK_IMAGE(icon), 32);
-        gtk_widget_add_css_class(icon, "dim-label");
-        gtk_widget_set_valign(icon, GTK_ALIGN_CENTER);
-        gtk_widget_set_halign(icon, GTK_ALIGN_CENTER);
-        gtk_widget_set_vexpand(icon, TRUE);
-        gtk_box_append(GTK_BOX(placeholder), icon);
-        gtk_box_append(GTK_BOX(row), placeholder);
-    }
+    GtkWidget* imageArea = gtk_picture_new();
+    gtk_widget_set_size_request(imageArea, 100, 70);
+    gtk_picture_set_content_fit(GTK_PICTURE(imageArea), GTK_CONTENT_FIT_CONTAIN);
+    gtk_picture_set_can_shrink(GTK_PICTURE(imageArea), TRUE);
+    gtk_widget_add_css_class(imageArea, "article-image");
+    g_signal_connect(imageArea, "map", G_CALLBACK(onArticlePictureMapped), nullptr);
+    gtk_box_append(GTK_BOX(row), imageArea);
+    
+    // Placeholder when no image
+    GtkWidget* placeholder = gtk_box_new(GTK_ORIENTATION_VERTICAL, 0);
+    gtk_widget_set_size_request(placeholder, 100, 70);
+    GtkWidget* icon = gtk_image_new_from_icon_name("application-rss+xml-symbolic");
+    gtk_image_set_pixel_size(GTK_IMAGE(icon), 32);
+    gtk_widget_add_css_class(icon, "dim-label");
+    gtk_widget_set_valign(icon, GTK_ALIGN_CENTER);
+    gtk_widget_set_halign(icon, GTK_ALIGN_CENTER);
+    gtk_widget_set_vexpand(icon, TRUE);
+    gtk_box_append(GTK_BOX(placeholder), icon);
+    gtk_box_append(GTK_BOX(row), placeholder);
     
     // Content area on the right
     GtkWidget* contentBox = gtk_box_new(GTK_ORIENTATION_VERTICAL, 4);
@@ -1074,13 +1625,11 @@ void RSSPanel::addArticleListItem(const RSSItem& item) {
     
     // Title row with saved indicator
     GtkWidget* titleBox = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 6);
-    if (isSaved) {
-        GtkWidget* star = gtk_image_new_from_icon_name("starred-symbolic");
-        gtk_widget_add_css_class(star, "accent");
-        gtk_box_append(GTK_BOX(titleBox), star);
-    }
+    GtkWidget* star = gtk_image_new_from_icon_name("starred-symbolic");
+    gtk_widget_add_css_class(star, "accent");
+    gtk_box_append(GTK_BOX(titleBox), star);
     
-    GtkWidget* titleLabel = gtk_label_new(item.title.c_str());
+    GtkWidget* titleLabel = gtk_label_new(nullptr);
     gtk_widget_add_css_class(titleLabel, "heading");
     gtk_label_set_wrap(GTK_LABEL(titleLabel), TRUE);
     gtk_label_set_max_width_chars(GTK_LABEL(titleLabel), 80);
@@ -1094,82 +1643,92 @@ void RSSPanel::addArticleListItem(const RSSItem& item) {
     // Source and date row
     GtkWidget* metaBox = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 8);
     
-    GtkWidget* sourceLabel = gtk_label_new(item.source.c_str());
+    GtkWidget* sourceLabel = gtk_label_new(nullptr);
     gtk_widget_add_css_class(sourceLabel, "dim-label");
     gtk_widget_add_css_class(sourceLabel, "caption");
     gtk_box_append(GTK_BOX(metaBox), sourceLabel);
     
-    if (!item.pubDate.empty()) {
-        GtkWidget* dot = gtk_label_new("•");
-        gtk_widget_add_css_class(dot, "dim-label");
-        gtk_box_append(GTK_BOX(metaBox), dot);
-        
-        std::string date = item.pubDate;
-        if (date.length() > 16) date = date.substr(0, 16);
-        GtkWidget* dateLabel = gtk_label_new(date.c_str());
-        gtk_widget_add_css_class(dateLabel, "dim-label");
-        gtk_widget_add_css_class(dateLabel, "caption");
-        gtk_box_append(GTK_BOX(metaBox), dateLabel);
-    }
+    GtkWidget* dot = gtk_label_new("•");
+    gtk_widget_add_css_class(dot, "dim-label");
+    gtk_box_append(GTK_BOX(metaBox), dot);
+    
+    GtkWidget* dateLabel = gtk_label_new(nullptr);
+    gtk_widget_add_css_class(dateLabel, "dim-label");
+    gtk_widget_add_css_class(dateLabel, "caption");
+    gtk_box_append(GTK_BOX(metaBox), dateLabel);
     gtk_box_append(GTK_BOX(contentBox), metaBox);
     
     // Description snippet
-    if (!item.description.empty()) {
-        std::string desc = item.description.substr(0, 200);
-        size_t lt = desc.find('<');
-        while (lt != std::string::npos) {
-            size_t gt = desc.find('>', lt);
-            if (gt != std::string::npos) desc.erase(lt, gt - lt + 1);
-            else break;
-            lt = desc.find('<');
-        }
-        // Clean up extra whitespace
-        size_t pos = 0;
-        while ((pos = desc.find("  ")) != std::string::npos) {
-            desc.erase(pos, 1);
-        }
-        if (!desc.empty()) {
-            GtkWidget* descLabel = gtk_label_new(desc.c_str());
-            gtk_widget_add_css_class(descLabel, "dim-label");
-            gtk_label_set_wrap(GTK_LABEL(descLabel), TRUE);
-            gtk_label_set_max_width_chars(GTK_LABEL(descLabel), 100);
-            gtk_label_set_lines(GTK_LABEL(descLabel), 2);
-            gtk_label_set_ellipsize(GTK_LABEL(descLabel), PANGO_ELLIPSIZE_END);
-            gtk_label_set_xalign(GTK_LABEL(descLabel), 0);
-            gtk_box_append(GTK_BOX(contentBox), descLabel);
-        }
-    }
-    
+    GtkWidget* descLabel = gtk_label_new(nullptr);
+    gtk_widget_add_css_class(descLabel, "dim-label");
+    gtk_label_set_wrap(GTK_LABEL(descLabel), TRUE);
+    gtk_label_set_max_width_chars(GTK_LABEL(descLabel), 100);
+    gtk_label_set_lines(GTK_LABEL(descLabel), 2);
+    gtk_label_set_ellipsize(GTK_LABEL(descLabel), PANGO_ELLIPSIZE_END);
+    gtk_label_set_xalign(GTK_LABEL(descLabel), 0);
+    gtk_box_append(GTK_BOX(contentBox), descLabel);
     gtk_box_append(GTK_BOX(row), contentBox);
     
-    // Left click gesture for opening article
-    GtkGesture* leftClick = gtk_gesture_click_new();
-    gtk_gesture_single_set_button(GTK_GESTURE_SINGLE(leftClick), GDK_BUTTON_PRIMARY);
-    char* linkCopy = g_strdup(item.link.c_str());
-    g_object_set_data_full(G_OBJECT(leftClick), "link", linkCopy, g_free);
-    g_object_set_data(G_OBJECT(leftClick), "row", row);
-    g_object_set_data(G_OBJECT(leftClick), "panel", this);
-    g_signal_connect(leftClick, "pressed", G_CALLBACK(+[](GtkGestureClick*, gint, gdouble, gdouble, gpointer userData) {
-        GtkGesture* gesture = static_cast<GtkGesture*>(userData);
-        const char* link = static_cast<const char*>(g_object_get_data(G_OBJECT(gesture), "link"));
-        GtkWidget* row = static_cast<GtkWidget*>(g_object_get_data(G_OBJECT(gesture), "row"));
-        RSSPanel* panel = static_cast<RSSPanel*>(g_object_get_data(G_OBJECT(gesture), "panel"));
-        if (link) {
-            Config::getInstance().markArticleRead(link);
-            gtk_widget_add_css_class(row, "read");
-            if (panel) panel->updateSidebar();
-            
-            std::string cmd = "xdg-open '" + std::string(link) + "'";
-            system(cmd.c_str());
-        }
-    }), leftClick);
-    gtk_widget_add_controller(row, GTK_EVENT_CONTROLLER(leftClick));
+    g_object_set_data(G_OBJECT(row), "image", imageArea);
+    g_object_set_data(G_OBJECT(row), "placeholder", placeholder);
+    g_object_set_data(G_OBJECT(row), "star", star);
+    g_object_set_data(G_OBJECT(row), "title", titleLabel);
+    g_object_set_data(G_OBJECT(row), "desc", descLabel);
+    g_object_set_data(G_OBJECT(row), "desc-limit", GUINT_TO_POINTER(200));
+    g_object_set_data(G_OBJECT(row), "source", sourceLabel);
+    g_object_set_data(G_OBJECT(row), "date", dateLabel);
+    g_object_set_data(G_OBJECT(row), "date-dot", dot);
+    panel->attachArticleGestures(row, listItem);
+    
+    gtk_list_item_set_activatable(listItem, FALSE);
+    gtk_list_item_set_child(listItem, row);
+}
+
+void RSSPanel::onArticleBind(GtkSignalListItemFactory*, GtkListItem* listItem, gpointer userData) {
+    auto* panel = static_cast<RSSPanel*>(userData);
+    const ArticleStore& articles = panel->articles_;
+    GtkWidget* root = gtk_list_item_get_child(listItem);
+    ArticleStore::Index index = ArticleListModel::indexOf(gtk_list_item_get_item(listItem));
+    if (!root || index >= articles.size()) return;
+    panel->boundWidgets_[index] = root;
+    auto part = [root](const char* name) {
+        return static_cast<GtkWidget*>(g_object_get_data(G_OBJECT(root), name));
+    };
     
-    // Wrap in list box row
-    GtkWidget* listRow = gtk_list_box_row_new();
-    gtk_list_box_row_set_child(GTK_LIST_BOX_ROW(listRow), row);
-    gtk_list_box_row_set_activatable(GTK_LIST_BOX_ROW(listRow), FALSE);
-    gtk_list_box_append(GTK_LIST_BOX(articlesContainer_), listRow);
+    auto& config = Config::getInstance();
+    std::string_view link = articles.link(index);
+    bool isSaved = config.isArticleSaved(std::string(link));
+    setCssClass(root, "read", config.isArticleRead(link));
+    setCssClass(root, "saved", isSaved);
+    gtk_widget_set_visible(part("star"), isSaved);
+    
+    showArticleImage(root, std::string(articles.imageUrl(index)));
+    
+    gtk_label_set_text(GTK_LABEL(part("title")), articles.title(index).data());
+    
+    auto limit = GPOINTER_TO_UINT(g_object_get_data(G_OBJECT(root), "desc-limit"));
+    std::string desc = descriptionExcerpt(articles.description(index), limit);
+    gtk_label_set_text(GTK_LABEL(part("desc")), desc.c_str());
+    gtk_widget_set_visible(part("desc"), !desc.empty());
+    
+    gtk_label_set_text(GTK_LABEL(part("source")), articles.source(index).c_str());
+    std::string date(articles.pubDate(index).substr(0, 16));
+    gtk_label_set_text(GTK_LABEL(part("date")), date.c_str());
+    gtk_widget_set_visible(part("date"), !date.empty());
+    if (GtkWidget* dot = part("date-dot")) gtk_widget_set_visible(dot, !date.empty());
+}
+
+void RSSPanel::onArticleUnbind(GtkSignalListItemFactory*, GtkListItem* listItem, gpointer userData) {
+    auto* panel = static_cast<RSSPanel*>(userData);
+    if (GtkWidget* root = gtk_list_item_get_child(listItem)) {
+        releaseArticleImage(static_cast<GtkWidget*>(g_object_get_data(G_OBJECT(root), "image")));
+    }
+    gpointer item = gtk_list_item_get_item(listItem);
+    if (!item) return;
+    auto it = panel->boundWidgets_.find(ArticleListModel::indexOf(item));
+    if (it != panel->boundWidgets_.end() && it->second == gtk_list_item_get_child(listItem)) {
+        panel->boundWidgets_.erase(it);
+    }
 }
 
 // Dialog structures
@@ -1233,7 +1792,7 @@ void RSSPanel::showFeedManagementDialog() {
     gtk_widget_add_css_class(listBox, "boxed-list");
     
     auto feeds = Config::getInstance().getFeeds();
-    for (const auto& f : feeds) {
+    for (const auto& f : *feeds) {
         GtkWidget* row = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 12);
         gtk_widget_set_margin_start(row, 12);
         gtk_widget_set_margin_end(row, 12);
@@ -1341,7 +1900,7 @@ void RSSPanel::showEditFeedDialog(const std::string& feedUrl, GtkWidget* parentD
     auto feeds = Config::getInstance().getFeeds();
     auto categories = Config::getInstance().getCategories();
     const FeedInfo* feed = nullptr;
-    for (const auto& f : feeds) if (f.url == feedUrl) { feed = &f; break; }
+    for (const auto& f : *feeds) if (f.url == feedUrl) { feed = &f; break; }
     if (!feed) return;
     
     GtkWidget* dialog = gtk_window_new();
@@ -1389,7 +1948,7 @@ void RSSPanel::showEditFeedDialog(const std::string& feedUrl, GtkWidget* parentD
     GtkStringList* catList = gtk_string_list_new(nullptr);
     guint selIdx = 0;
     std::vector<Category> filteredCats;
-    for (const auto& c : categories) {
+    for (const auto& c : *categories) {
         if (c.id != "all" && c.id != "saved") {
             filteredCats.push_back(c);
         }
@@ -1540,7 +2099,7 @@ void RSSPanel::showAddFeedDialog() {
     GtkStringList* catList = gtk_string_list_new(nullptr);
     auto categories = Config::getInstance().getCategories();
     std::vector<Category> filteredCats;
-    for (const auto& c : categories) {
+    for (const auto& c : *categories) {
         if (c.id != "all" && c.id != "saved") {
             filteredCats.push_back(c);
             gtk_string_list_append(catList, c.name.c_str());
@@ -1650,21 +2209,13 @@ std::vector<DiscoveredFeed> RSSPanel::discoverFeeds(const std::string& url) {
     std::string fullUrl = url;
     if (fullUrl.find("://") == std::string::npos) fullUrl = "https://" + fullUrl;
     
-    CURL* curl = curl_easy_init();
-    if (!curl) return feeds;
-    
-    std::string html;
-    curl_easy_setopt(curl, CURLOPT_URL, fullUrl.c_str());
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &html);
-    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
-    curl_easy_setopt(curl, CURLOPT_TIMEOUT, 15L);
-    curl_easy_setopt(curl, CURLOPT_USERAGENT, "InfoDash/1.0");
-    
-    CURLcode res = curl_easy_perform(curl);
-    curl_easy_cleanup(curl);
+    HttpClient client;
+    client.setUserAgent("InfoDash/1.0");
+    client.setTimeout(15);
+    auto response = client.get(fullUrl);
+    const std::string& html = response.body;
     
-    if (res != CURLE_OK || html.empty()) return feeds;
+    if (!response.error.empty() || html.empty()) return feeds;
     
     if (isRSSFeed(html)) {
         feeds.push_back({fullUrl, "Direct RSS Feed", "rss"});
@@ -1808,7 +2359,7 @@ void RSSPanel::showFeedDiscoveryDialog(const std::vector<DiscoveredFeed>& feeds,
     GtkStringList* catList = gtk_string_list_new(nullptr);
     auto categories = Config::getInstance().getCategories();
     std::vector<Category> filteredCats;
-    for (const auto& c : categories) {
+    for (const auto& c : *categories) {
         if (c.id != "all" && c.id != "saved") {
             filteredCats.push_back(c);
             gtk_string_list_append(catList, c.name.c_str());
@@ -1854,12 +2405,20 @@ void RSSPanel::onCategorySelected(GtkListBox*, GtkListBoxRow* row, gpointer data
     if (catId) static_cast<RSSPanel*>(data)->selectCategory(catId);
 }
 
+void RSSPanel::onSearchChanged(GtkSearchEntry* entry, gpointer data) {
+    auto* panel = static_cast<RSSPanel*>(data);
+    panel->searchQuery_ = gtk_editable_get_text(GTK_EDITABLE(entry));
+    panel->loadFeedsForCategory(panel->currentCategory_);
+    scrollToTop(panel->articlesScrolled_);
+}
+
 void RSSPanel::onMarkAllReadClicked(GtkButton*, gpointer data) {
     auto* panel = static_cast<RSSPanel*>(data);
     auto& config = Config::getInstance();
-    for (const auto& item : panel->allItems_) {
-        config.markArticleRead(item.link);
+    for (ArticleStore::Index i : panel->articleOrder_) {
+        config.markArticleRead(std::string(panel->articles_.link(i)));
     }
+    panel->unreadCounts_.rebuild(panel->articles_, panel->articleOrder_, config);
     panel->updateSidebar();
     panel->loadFeedsForCategory(panel->currentCategory_);
 }
@@ -22,6 +22,7 @@ static void onRemoveStockClicked(GtkButton* btn, gpointer userData) {
 StockPanel::StockPanel() : widget_(nullptr), tickerBox_(nullptr), stocksBox_(nullptr), symbolEntry_(nullptr), tickerTimerId_(0) {
     service_ = std::make_unique<StockService>();
     setupUI();
+    loadCached();
     refresh();
 }
 
@@ -80,8 +81,23 @@ void StockPanel::refresh() {
     });
 }
 
+// Show the last-known data from the disk cache while refresh() revalidates.
+void StockPanel::loadCached() {
+    service_->loadCachedStocks([this](std::vector<StockData> data) {
+        if (data.empty()) return;
+        auto* payload = new std::pair<StockPanel*, std::vector<StockData>>(this, std::move(data));
+        g_idle_add(+[](gpointer userData) -> gboolean {
+            std::unique_ptr<std::pair<StockPanel*, std::vector<StockData>>> p(
+                static_cast<std::pair<StockPanel*, std::vector<StockData>>*>(userData));
+            if (!p->first->liveDataShown_) p->first->updateStocks(p->second);
+            return G_SOURCE_REMOVE;
+        }, payload);
+    });
+}
+
 gboolean StockPanel::updateUICallback(gpointer userData) {
     auto* self = static_cast<StockPanel*>(userData);
+    self->liveDataShown_ = true;
     self->updateStocks(self->pendingData_);
     return FALSE;
 }
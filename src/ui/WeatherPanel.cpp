@@ -10,6 +10,7 @@ WeatherPanel::WeatherPanel() : widget_(nullptr), weatherBox_(nullptr),
                                loadingLabel_(nullptr) {
     service_ = std::make_unique<WeatherService>();
     setupUI();
+    loadCached();
     refresh();
 }
 
@@ -87,14 +88,14 @@ void WeatherPanel::updateLocationsBar() {
     gtk_widget_add_css_class(label, "locations-label");
     gtk_box_append(GTK_BOX(locationsBox_), label);
 
-    for (const auto& loc : locations) {
+    for (const auto& loc : *locations) {
         GtkWidget* tag = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 4);
         gtk_widget_add_css_class(tag, "location-tag");
 
         GtkWidget* tagLabel = gtk_label_new(loc.c_str());
         gtk_box_append(GTK_BOX(tag), tagLabel);
 
-        if (locations.size() > 1) {
+        if (locations->size() > 1) {
             GtkWidget* removeBtn = gtk_button_new_from_icon_name("window-close-symbolic");
             gtk_widget_add_css_class(removeBtn, "location-remove-btn");
             gtk_widget_add_css_class(removeBtn, "flat");
@@ -135,8 +136,23 @@ void WeatherPanel::refresh() {
     });
 }
 
+// Show the last-known data from the disk cache while refresh() revalidates.
+void WeatherPanel::loadCached() {
+    service_->loadCachedLocations([this](std::vector<WeatherData> data) {
+        if (data.empty()) return;
+        auto* payload = new std::pair<WeatherPanel*, std::vector<WeatherData>>(this, std::move(data));
+        g_idle_add(+[](gpointer userData) -> gboolean {
+            std::unique_ptr<std::pair<WeatherPanel*, std::vector<WeatherData>>> p(
+                static_cast<std::pair<WeatherPanel*, std::vector<WeatherData>>*>(userData));
+            if (!p->first->liveDataShown_) p->first->updateWeather(p->second);
+            return G_SOURCE_REMOVE;
+        }, payload);
+    });
+}
+
 gboolean WeatherPanel::updateUICallback(gpointer userData) {
     auto* self = static_cast<WeatherPanel*>(userData);
+    self->liveDataShown_ = true;
     self->showLoading(false);
     self->updateWeather(self->pendingData_);
     return FALSE;
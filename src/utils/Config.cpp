@@ -2,8 +2,11 @@
 #include "utils/ThemeManager.hpp"
 #include <json-glib/json-glib.h>
 #include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include <fstream>
 #include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <iostream>
 
@@ -38,6 +41,56 @@ static bool createDirectoryRecursive(const std::string& path) {
     return true;
 }
 
+// Rewrite scheduling: a burst of changes becomes one config.json rewrite,
+// and a long journal is folded back into config.json.
+static constexpr guint kSaveDelayMs = 1000;
+static constexpr auto kWriteDelay = std::chrono::milliseconds(300);
+static constexpr size_t kJournalCompactLines = 500;
+
+static bool writeAll(int fd, const std::string& data) {
+    const char* p = data.data();
+    size_t left = data.size();
+    while (left > 0) {
+        ssize_t n = write(fd, p, left);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        p += n;
+        left -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+// Write to a temporary file and rename it over `path`, so a crash leaves
+// either the old file or the new one.
+static bool replaceFile(const std::string& path, const std::string& data) {
+    std::string tmp = path + ".tmp";
+    int fd = open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) return false;
+    bool ok = writeAll(fd, data) && fsync(fd) == 0;
+    ok = close(fd) == 0 && ok;
+    if (!ok || rename(tmp.c_str(), path.c_str()) != 0) {
+        unlink(tmp.c_str());
+        return false;
+    }
+    return true;
+}
+
+static bool appendFile(const std::string& path, const std::string& data) {
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (fd < 0) return false;
+    bool ok = writeAll(fd, data);
+    return close(fd) == 0 && ok;
+}
+
+// Snapshots keep categories in display order.
+static void sortCategories(std::vector<Category>& cats) {
+    std::stable_sort(cats.begin(), cats.end(), [](const Category& a, const Category& b) {
+        return a.order < b.order;
+    });
+}
+
 ThemePreferences::ThemePreferences() : mode(ThemeMode::Dark), scheme(ColorScheme::Default), customAccentColor("#e94560") {}
 
 
@@ -46,10 +99,21 @@ Config& Config::getInstance() {
     return instance;
 }
 
-Config::Config() : tempUnit_(TempUnit::Fahrenheit) {
+Config::Config() : snapshot_(std::make_shared<const ConfigSnapshot>()) {
+    writer_ = std::thread([this]() { writerLoop(); });
     load();
 }
 
+Config::~Config() {
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        stopping_ = true;
+    }
+    writeCv_.notify_all();
+    if (writer_.joinable()) writer_.join();
+}
+
 std::string Config::getConfigPath() const {
     // Respect XDG_CONFIG_HOME if set, otherwise use ~/.config
     const char* xdgConfig = getenv("XDG_CONFIG_HOME");
@@ -66,9 +130,30 @@ std::string Config::getConfigPath() const {
     return configBase + "/infodash/config.json";
 }
 
-void Config::ensureDefaults() {
-    if (categories_.empty()) {
-        categories_ = {
+std::string Config::getJournalPath() const {
+    std::string configPath = getConfigPath();
+    return configPath.substr(0, configPath.rfind('/')) + "/state.journal";
+}
+
+std::string Config::getCachePath() const {
+    // Respect XDG_CACHE_HOME if set, otherwise use ~/.cache
+    const char* xdgCache = getenv("XDG_CACHE_HOME");
+    std::string cacheBase;
+    
+    if (xdgCache && xdgCache[0] != '\0') {
+        cacheBase = xdgCache;
+    } else {
+        const char* home = getenv("HOME");
+        if (!home) home = "/tmp";
+        cacheBase = std::string(home) + "/.cache";
+    }
+    
+    return cacheBase + "/infodash";
+}
+
+void Config::ensureDefaults(ConfigSnapshot& s) {
+    if (s.categories.empty()) {
+        s.categories = {
             {"all", "All Articles", "rss-symbolic", 0},
             {"saved", "Saved for Later", "starred-symbolic", 1},
             {"tech", "Technology", "computer-symbolic", 2},
@@ -81,27 +166,27 @@ void Config::ensureDefaults() {
     
     // Ensure "saved" category exists
     bool hasSaved = false;
-    for (const auto& c : categories_) {
+    for (const auto& c : s.categories) {
         if (c.id == "saved") { hasSaved = true; break; }
     }
     if (!hasSaved) {
-        categories_.insert(categories_.begin() + 1, {"saved", "Saved for Later", "starred-symbolic", 1});
+        s.categories.insert(s.categories.begin() + 1, {"saved", "Saved for Later", "starred-symbolic", 1});
     }
     
-    if (feeds_.empty()) {
-        feeds_ = {
+    if (s.feeds.empty()) {
+        s.feeds = {
             {"https://feeds.arstechnica.com/arstechnica/index", "Ars Technica", "tech", true},
             {"https://www.reddit.com/r/linux.rss", "r/linux", "tech", true},
             {"https://news.ycombinator.com/rss", "Hacker News", "tech", true}
         };
     }
     
-    if (stockSymbols_.empty()) {
-        stockSymbols_ = {"AAPL", "GOOGL", "MSFT", "AMZN"};
+    if (s.stockSymbols.empty()) {
+        s.stockSymbols = {"AAPL", "GOOGL", "MSFT", "AMZN"};
     }
     
-    if (weatherLocations_.empty()) {
-        weatherLocations_ = {"auto"};
+    if (s.weatherLocations.empty()) {
+        s.weatherLocations = {"auto"};
     }
 }
 
@@ -120,7 +205,10 @@ void Config::load() {
     if (!json_parser_load_from_file(parser, configPath.c_str(), &error)) {
         if (error) g_error_free(error);
         g_object_unref(parser);
-        ensureDefaults();
+        auto fresh = std::make_shared<ConfigSnapshot>();
+        ensureDefaults(*fresh);
+        snapshot_.store(std::move(fresh), std::memory_order_release);
+        replayJournal();
         save();
         return;
     }
@@ -128,14 +216,19 @@ void Config::load() {
     JsonNode* root = json_parser_get_root(parser);
     if (!root || !JSON_NODE_HOLDS_OBJECT(root)) {
         g_object_unref(parser);
-        ensureDefaults();
+        auto fresh = std::make_shared<ConfigSnapshot>();
+        ensureDefaults(*fresh);
+        snapshot_.store(std::move(fresh), std::memory_order_release);
+        replayJournal();
         return;
     }
     
     JsonObject* obj = json_node_get_object(root);
+    auto next = std::make_shared<ConfigSnapshot>();
+    ConfigSnapshot& s = *next;
     
     // Load categories
-    categories_.clear();
+    s.categories.clear();
     if (json_object_has_member(obj, "categories")) {
         JsonArray* cats = json_object_get_array_member(obj, "categories");
         guint len = json_array_get_length(cats);
@@ -146,12 +239,12 @@ void Config::load() {
             c.name = json_object_get_string_member(cat, "name");
             c.icon = json_object_has_member(cat, "icon") ? json_object_get_string_member(cat, "icon") : "folder-symbolic";
             c.order = json_object_has_member(cat, "order") ? json_object_get_int_member(cat, "order") : i;
-            categories_.push_back(c);
+            s.categories.push_back(c);
         }
     }
     
     // Load feeds
-    feeds_.clear();
+    s.feeds.clear();
     if (json_object_has_member(obj, "feeds")) {
         JsonArray* feedsArr = json_object_get_array_member(obj, "feeds");
         guint len = json_array_get_length(feedsArr);
@@ -162,12 +255,12 @@ void Config::load() {
             f.name = json_object_has_member(feed, "name") ? json_object_get_string_member(feed, "name") : "";
             f.category = json_object_has_member(feed, "category") ? json_object_get_string_member(feed, "category") : "uncategorized";
             f.enabled = !json_object_has_member(feed, "enabled") || json_object_get_boolean_member(feed, "enabled");
-            feeds_.push_back(f);
+            s.feeds.push_back(f);
         }
     }
     
     // Load legacy RSS feeds format
-    if (feeds_.empty() && json_object_has_member(obj, "rssFeeds")) {
+    if (s.feeds.empty() && json_object_has_member(obj, "rssFeeds")) {
         JsonArray* rssArr = json_object_get_array_member(obj, "rssFeeds");
         guint len = json_array_get_length(rssArr);
         for (guint i = 0; i < len; i++) {
@@ -176,17 +269,29 @@ void Config::load() {
             f.name = "";
             f.category = "uncategorized";
             f.enabled = true;
-            feeds_.push_back(f);
+            s.feeds.push_back(f);
         }
     }
     
-    // Load read articles
+    // Load read articles; older configs list them as URLs. A hand-edited
+    // file may hold anything here, so the types are checked.
     readArticles_.clear();
-    if (json_object_has_member(obj, "readArticles")) {
-        JsonArray* readArr = json_object_get_array_member(obj, "readArticles");
+    JsonNode* readState = json_object_get_member(obj, "readState");
+    if (readState && JSON_NODE_HOLDS_VALUE(readState)) {
+        if (const char* text = json_node_get_string(readState)) readArticles_.decode(text);
+    }
+    readSeenDay_ = json_object_has_member(obj, "readStateSeenDay")
+        ? static_cast<ReadSet::Day>(json_object_get_int_member(obj, "readStateSeenDay")) : 0;
+    JsonNode* legacyRead = json_object_get_member(obj, "readArticles");
+    bool legacyReadList = legacyRead != nullptr;
+    if (legacyRead && JSON_NODE_HOLDS_ARRAY(legacyRead)) {
+        JsonArray* readArr = json_node_get_array(legacyRead);
         guint len = json_array_get_length(readArr);
+        ReadSet::Day today = ReadSet::today();
         for (guint i = 0; i < len; i++) {
-            readArticles_.insert(json_array_get_string_element(readArr, i));
+            if (const char* url = json_array_get_string_element(readArr, i)) {
+                readArticles_.insert(ReadSet::hash(url), today);
+            }
         }
     }
     
@@ -211,50 +316,56 @@ void Config::load() {
     }
     
     // Load weather locations (array) or legacy single location
-    weatherLocations_.clear();
+    s.weatherLocations.clear();
     if (json_object_has_member(obj, "weatherLocations")) {
         JsonArray* locArr = json_object_get_array_member(obj, "weatherLocations");
         guint len = json_array_get_length(locArr);
         for (guint i = 0; i < len; i++) {
-            weatherLocations_.push_back(json_array_get_string_element(locArr, i));
+            s.weatherLocations.push_back(json_array_get_string_element(locArr, i));
         }
     } else if (json_object_has_member(obj, "weatherLocation")) {
         // Legacy single location
-        weatherLocations_.push_back(json_object_get_string_member(obj, "weatherLocation"));
+        s.weatherLocations.push_back(json_object_get_string_member(obj, "weatherLocation"));
     }
     
     // Load temperature unit
-    tempUnit_ = TempUnit::Fahrenheit;
+    s.tempUnit = TempUnit::Fahrenheit;
     if (json_object_has_member(obj, "tempUnit")) {
         const char* unit = json_object_get_string_member(obj, "tempUnit");
         if (unit && strcmp(unit, "celsius") == 0) {
-            tempUnit_ = TempUnit::Celsius;
+            s.tempUnit = TempUnit::Celsius;
         }
     }
     
     // Load stock symbols
-    stockSymbols_.clear();
+    s.stockSymbols.clear();
     if (json_object_has_member(obj, "stockSymbols")) {
         JsonArray* stocksArr = json_object_get_array_member(obj, "stockSymbols");
         guint len = json_array_get_length(stocksArr);
         for (guint i = 0; i < len; i++) {
-            stockSymbols_.push_back(json_array_get_string_element(stocksArr, i));
+            s.stockSymbols.push_back(json_array_get_string_element(stocksArr, i));
         }
     }
     
     // Load layout mode
-    layoutMode_ = LayoutMode::Cards;
+    s.layoutMode = LayoutMode::Cards;
     if (json_object_has_member(obj, "layoutMode")) {
         const char* mode = json_object_get_string_member(obj, "layoutMode");
         if (mode && strcmp(mode, "list") == 0) {
-            layoutMode_ = LayoutMode::List;
+            s.layoutMode = LayoutMode::List;
         }
     }
     
+    // Load image cache budget
+    s.imageCacheMB = 128;
+    if (json_object_has_member(obj, "imageCacheMB")) {
+        s.imageCacheMB = std::max<int>(8, json_object_get_int_member(obj, "imageCacheMB"));
+    }
+    
     // Load theme preferences
-    themePrefs_.mode = ThemeMode::Dark;
-    themePrefs_.scheme = ColorScheme::Default;
-    themePrefs_.customAccentColor = "#e94560";
+    s.themePrefs.mode = ThemeMode::Dark;
+    s.themePrefs.scheme = ColorScheme::Default;
+    s.themePrefs.customAccentColor = "#e94560";
     
     if (json_object_has_member(obj, "theme")) {
         JsonObject* themeObj = json_object_get_object_member(obj, "theme");
@@ -262,66 +373,186 @@ void Config::load() {
         if (json_object_has_member(themeObj, "mode")) {
             const char* mode = json_object_get_string_member(themeObj, "mode");
             if (mode) {
-                if (strcmp(mode, "light") == 0) themePrefs_.mode = ThemeMode::Light;
-                else if (strcmp(mode, "system") == 0) themePrefs_.mode = ThemeMode::System;
-                else themePrefs_.mode = ThemeMode::Dark;
+                if (strcmp(mode, "light") == 0) s.themePrefs.mode = ThemeMode::Light;
+                else if (strcmp(mode, "system") == 0) s.themePrefs.mode = ThemeMode::System;
+                else s.themePrefs.mode = ThemeMode::Dark;
             }
         }
         
         if (json_object_has_member(themeObj, "scheme")) {
             const char* scheme = json_object_get_string_member(themeObj, "scheme");
             if (scheme) {
-                if (strcmp(scheme, "ocean") == 0) themePrefs_.scheme = ColorScheme::Ocean;
-                else if (strcmp(scheme, "forest") == 0) themePrefs_.scheme = ColorScheme::Forest;
-                else if (strcmp(scheme, "sunset") == 0) themePrefs_.scheme = ColorScheme::Sunset;
-                else if (strcmp(scheme, "midnight") == 0) themePrefs_.scheme = ColorScheme::Midnight;
-                else if (strcmp(scheme, "nord") == 0) themePrefs_.scheme = ColorScheme::Nord;
-                else if (strcmp(scheme, "dracula") == 0) themePrefs_.scheme = ColorScheme::Dracula;
-                else if (strcmp(scheme, "solarized") == 0) themePrefs_.scheme = ColorScheme::Solarized;
-                else if (strcmp(scheme, "rose") == 0) themePrefs_.scheme = ColorScheme::Rose;
-                else if (strcmp(scheme, "custom") == 0) themePrefs_.scheme = ColorScheme::Custom;
-                else themePrefs_.scheme = ColorScheme::Default;
+                if (strcmp(scheme, "ocean") == 0) s.themePrefs.scheme = ColorScheme::Ocean;
+                else if (strcmp(scheme, "forest") == 0) s.themePrefs.scheme = ColorScheme::Forest;
+                else if (strcmp(scheme, "sunset") == 0) s.themePrefs.scheme = ColorScheme::Sunset;
+                else if (strcmp(scheme, "midnight") == 0) s.themePrefs.scheme = ColorScheme::Midnight;
+                else if (strcmp(scheme, "nord") == 0) s.themePrefs.scheme = ColorScheme::Nord;
+                else if (strcmp(scheme, "dracula") == 0) s.themePrefs.scheme = ColorScheme::Dracula;
+                else if (strcmp(scheme, "solarized") == 0) s.themePrefs.scheme = ColorScheme::Solarized;
+                else if (strcmp(scheme, "rose") == 0) s.themePrefs.scheme = ColorScheme::Rose;
+                else if (strcmp(scheme, "custom") == 0) s.themePrefs.scheme = ColorScheme::Custom;
+                else s.themePrefs.scheme = ColorScheme::Default;
             }
         }
         
         if (json_object_has_member(themeObj, "customAccentColor")) {
-            themePrefs_.customAccentColor = json_object_get_string_member(themeObj, "customAccentColor");
+            s.themePrefs.customAccentColor = json_object_get_string_member(themeObj, "customAccentColor");
         }
         
         if (json_object_has_member(themeObj, "customWindowBg")) {
-            themePrefs_.customWindowBg = json_object_get_string_member(themeObj, "customWindowBg");
+            s.themePrefs.customWindowBg = json_object_get_string_member(themeObj, "customWindowBg");
         }
         if (json_object_has_member(themeObj, "customCardBg")) {
-            themePrefs_.customCardBg = json_object_get_string_member(themeObj, "customCardBg");
+            s.themePrefs.customCardBg = json_object_get_string_member(themeObj, "customCardBg");
         }
         if (json_object_has_member(themeObj, "customTextPrimary")) {
-            themePrefs_.customTextPrimary = json_object_get_string_member(themeObj, "customTextPrimary");
+            s.themePrefs.customTextPrimary = json_object_get_string_member(themeObj, "customTextPrimary");
         }
         if (json_object_has_member(themeObj, "customTextSecondary")) {
-            themePrefs_.customTextSecondary = json_object_get_string_member(themeObj, "customTextSecondary");
+            s.themePrefs.customTextSecondary = json_object_get_string_member(themeObj, "customTextSecondary");
         }
     }
     
     g_object_unref(parser);
-    ensureDefaults();
+    ensureDefaults(s);
+    sortCategories(s.categories);
+    snapshot_.store(std::move(next), std::memory_order_release);
+    
+    // Marks made since config.json was last written; fold them in soon,
+    // along with expiry and any migration of the old URL list. Expiry
+    // counts from the last refresh that reported what feeds offer, not
+    // from today: after weeks offline every mark would look stale.
+    bool changed = replayJournal() > 0;
+    if (readSeenDay_ > kReadExpiryDays) {
+        changed = readArticles_.expire(static_cast<ReadSet::Day>(readSeenDay_ - kReadExpiryDays)) > 0 || changed;
+    }
+    if (changed || legacyReadList) save();
+}
+
+// Apply the journal on top of what load() read. A last line without its
+// newline was cut short by a crash and is ignored.
+size_t Config::replayJournal() {
+    std::ifstream in(getJournalPath());
+    std::string line;
+    size_t lines = 0;
+    ReadSet::Day today = ReadSet::today();
+    while (std::getline(in, line) && !in.eof()) {
+        if (line.size() < 3 || line[1] != ' ') continue;
+        std::string id = line.substr(2);
+        switch (line[0]) {
+            case 'R': readArticles_.insert(ReadSet::hash(id), today); break;
+            case 'U': readArticles_.erase(ReadSet::hash(id)); break;
+            case 'S': savedArticles_.insert(id); break;
+            case 'X': savedArticles_.erase(id); break;
+            case 'E': expandedCategories_.insert(id); break;
+            case 'C': expandedCategories_.erase(id); break;
+            default: continue;
+        }
+        ++lines;
+    }
+    journalLines_ = lines;
+    return lines;
 }
 
 void Config::save() {
-    // Ensure config directory exists before saving
-    std::string configPath = getConfigPath();
-    std::string dir = configPath.substr(0, configPath.rfind('/'));
-    if (!createDirectoryRecursive(dir)) {
-        std::cerr << "Error: Could not create config directory for saving: " << dir << std::endl;
+    if (saveTimer_) return;
+    saveTimer_ = g_timeout_add(kSaveDelayMs, +[](gpointer data) -> gboolean {
+        auto* config = static_cast<Config*>(data);
+        config->saveTimer_ = 0;
+        config->queueRewrite();
+        return G_SOURCE_REMOVE;
+    }, this);
+}
+
+void Config::flush() {
+    if (saveTimer_) {
+        g_source_remove(saveTimer_);
+        saveTimer_ = 0;
+        queueRewrite();
+    }
+    std::unique_lock<std::mutex> lock(writeMutex_);
+    flushing_ = true;
+    writeCv_.notify_all();
+    writeCv_.wait(lock, [this]() { return writeJobs_.empty() && !writing_; });
+    flushing_ = false;
+}
+
+void Config::queueRewrite() {
+    std::string json = toJson();
+    journalLines_ = 0;
+    {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        // The rewrite already holds every change queued before it.
+        writeJobs_.clear();
+        writeJobs_.push_back({true, std::move(json)});
+    }
+    writeCv_.notify_all();
+}
+
+// One journal line per mark: an op letter, a space, the ID.
+void Config::journal(char op, const std::string& id) {
+    if (id.find('\n') != std::string::npos) {
+        save();
         return;
     }
-    
+    std::string line = std::string(1, op) + " " + id + "\n";
+    {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        if (!writeJobs_.empty() && !writeJobs_.back().fullFile) {
+            writeJobs_.back().data += line;
+        } else {
+            writeJobs_.push_back({false, std::move(line)});
+        }
+    }
+    writeCv_.notify_all();
+    if (++journalLines_ >= kJournalCompactLines) save();
+}
+
+void Config::writerLoop() {
+    std::unique_lock<std::mutex> lock(writeMutex_);
+    for (;;) {
+        writeCv_.wait(lock, [this]() { return stopping_ || !writeJobs_.empty(); });
+        if (writeJobs_.empty()) return;
+        // Let a burst of clicks collapse into one write.
+        writeCv_.wait_for(lock, kWriteDelay, [this]() { return stopping_ || flushing_; });
+        std::deque<WriteJob> jobs;
+        jobs.swap(writeJobs_);
+        writing_ = true;
+        lock.unlock();
+        
+        std::string configPath = getConfigPath();
+        std::string dir = configPath.substr(0, configPath.rfind('/'));
+        if (!createDirectoryRecursive(dir)) {
+            std::cerr << "Error: Could not create config directory for saving: " << dir << std::endl;
+        }
+        for (const auto& job : jobs) {
+            if (!job.fullFile) {
+                if (!appendFile(getJournalPath(), job.data)) {
+                    std::cerr << "Error appending to " << getJournalPath() << std::endl;
+                }
+            } else if (replaceFile(configPath, job.data)) {
+                truncate(getJournalPath().c_str(), 0);
+            } else {
+                std::cerr << "Error saving config to " << configPath << ": " << strerror(errno) << std::endl;
+            }
+        }
+        
+        lock.lock();
+        writing_ = false;
+        writeCv_.notify_all();
+    }
+}
+
+std::string Config::toJson() const {
+    auto snap = snapshot();
+    const ConfigSnapshot& s = *snap;
     JsonBuilder* builder = json_builder_new();
     json_builder_begin_object(builder);
     
     // Save categories
     json_builder_set_member_name(builder, "categories");
     json_builder_begin_array(builder);
-    for (const auto& cat : categories_) {
+    for (const auto& cat : s.categories) {
         json_builder_begin_object(builder);
         json_builder_set_member_name(builder, "id");
         json_builder_add_string_value(builder, cat.id.c_str());
@@ -338,7 +569,7 @@ void Config::save() {
     // Save feeds
     json_builder_set_member_name(builder, "feeds");
     json_builder_begin_array(builder);
-    for (const auto& feed : feeds_) {
+    for (const auto& feed : s.feeds) {
         json_builder_begin_object(builder);
         json_builder_set_member_name(builder, "url");
         json_builder_add_string_value(builder, feed.url.c_str());
@@ -352,15 +583,11 @@ void Config::save() {
     }
     json_builder_end_array(builder);
     
-    // Save read articles (limit to last 1000)
-    json_builder_set_member_name(builder, "readArticles");
-    json_builder_begin_array(builder);
-    int count = 0;
-    for (const auto& id : readArticles_) {
-        if (count++ >= 1000) break;
-        json_builder_add_string_value(builder, id.c_str());
-    }
-    json_builder_end_array(builder);
+    // Save read articles as hashes
+    json_builder_set_member_name(builder, "readState");
+    json_builder_add_string_value(builder, readArticles_.encode().c_str());
+    json_builder_set_member_name(builder, "readStateSeenDay");
+    json_builder_add_int_value(builder, readSeenDay_);
     
     // Save saved articles
     json_builder_set_member_name(builder, "savedArticles");
@@ -381,26 +608,30 @@ void Config::save() {
     // Save weather locations (as array)
     json_builder_set_member_name(builder, "weatherLocations");
     json_builder_begin_array(builder);
-    for (const auto& loc : weatherLocations_) {
+    for (const auto& loc : s.weatherLocations) {
         json_builder_add_string_value(builder, loc.c_str());
     }
     json_builder_end_array(builder);
     
     // Save temperature unit
     json_builder_set_member_name(builder, "tempUnit");
-    json_builder_add_string_value(builder, tempUnit_ == TempUnit::Celsius ? "celsius" : "fahrenheit");
+    json_builder_add_string_value(builder, s.tempUnit == TempUnit::Celsius ? "celsius" : "fahrenheit");
     
     // Save stock symbols
     json_builder_set_member_name(builder, "stockSymbols");
     json_builder_begin_array(builder);
-    for (const auto& sym : stockSymbols_) {
+    for (const auto& sym : s.stockSymbols) {
         json_builder_add_string_value(builder, sym.c_str());
     }
     json_builder_end_array(builder);
     
     // Save layout mode
     json_builder_set_member_name(builder, "layoutMode");
-    json_builder_add_string_value(builder, layoutMode_ == LayoutMode::List ? "list" : "cards");
+    json_builder_add_string_value(builder, s.layoutMode == LayoutMode::List ? "list" : "cards");
+    
+    // Save image cache budget
+    json_builder_set_member_name(builder, "imageCacheMB");
+    json_builder_add_int_value(builder, s.imageCacheMB);
     
     // Save theme preferences
     json_builder_set_member_name(builder, "theme");
@@ -408,13 +639,13 @@ void Config::save() {
     
     json_builder_set_member_name(builder, "mode");
     const char* modeStr = "dark";
-    if (themePrefs_.mode == ThemeMode::Light) modeStr = "light";
-    else if (themePrefs_.mode == ThemeMode::System) modeStr = "system";
+    if (s.themePrefs.mode == ThemeMode::Light) modeStr = "light";
+    else if (s.themePrefs.mode == ThemeMode::System) modeStr = "system";
     json_builder_add_string_value(builder, modeStr);
     
     json_builder_set_member_name(builder, "scheme");
     const char* schemeStr = "default";
-    switch (themePrefs_.scheme) {
+    switch (s.themePrefs.scheme) {
         case ColorScheme::Ocean: schemeStr = "ocean"; break;
         case ColorScheme::Forest: schemeStr = "forest"; break;
         case ColorScheme::Sunset: schemeStr = "sunset"; break;
@@ -429,23 +660,23 @@ void Config::save() {
     json_builder_add_string_value(builder, schemeStr);
     
     json_builder_set_member_name(builder, "customAccentColor");
-    json_builder_add_string_value(builder, themePrefs_.customAccentColor.c_str());
+    json_builder_add_string_value(builder, s.themePrefs.customAccentColor.c_str());
     
-    if (!themePrefs_.customWindowBg.empty()) {
+    if (!s.themePrefs.customWindowBg.empty()) {
         json_builder_set_member_name(builder, "customWindowBg");
-        json_builder_add_string_value(builder, themePrefs_.customWindowBg.c_str());
+        json_builder_add_string_value(builder, s.themePrefs.customWindowBg.c_str());
     }
-    if (!themePrefs_.customCardBg.empty()) {
+    if (!s.themePrefs.customCardBg.empty()) {
         json_builder_set_member_name(builder, "customCardBg");
-        json_builder_add_string_value(builder, themePrefs_.customCardBg.c_str());
+        json_builder_add_string_value(builder, s.themePrefs.customCardBg.c_str());
     }
-    if (!themePrefs_.customTextPrimary.empty()) {
+    if (!s.themePrefs.customTextPrimary.empty()) {
         json_builder_set_member_name(builder, "customTextPrimary");
-        json_builder_add_string_value(builder, themePrefs_.customTextPrimary.c_str());
+        json_builder_add_string_value(builder, s.themePrefs.customTextPrimary.c_str());
     }
-    if (!themePrefs_.customTextSecondary.empty()) {
+    if (!s.themePrefs.customTextSecondary.empty()) {
         json_builder_set_member_name(builder, "customTextSecondary");
-        json_builder_add_string_value(builder, themePrefs_.customTextSecondary.c_str());
+        json_builder_add_string_value(builder, s.themePrefs.customTextSecondary.c_str());
     }
     
     json_builder_end_object(builder);
@@ -457,55 +688,72 @@ void Config::save() {
     JsonNode* rootNode = json_builder_get_root(builder);
     json_generator_set_root(gen, rootNode);
     
-    GError* error = nullptr;
-    if (!json_generator_to_file(gen, getConfigPath().c_str(), &error)) {
-        std::cerr << "Error saving config to " << getConfigPath();
-        if (error) {
-            std::cerr << ": " << error->message;
-            g_error_free(error);
-        }
-        std::cerr << std::endl;
-    }
+    gchar* data = json_generator_to_data(gen, nullptr);
+    std::string json = data ? data : "";
+    g_free(data);
     
     json_node_unref(rootNode);
     g_object_unref(gen);
     g_object_unref(builder);
+    return json;
 }
 
-// Feed management
-std::vector<FeedInfo> Config::getFeeds() const {
-    return feeds_;
+std::shared_ptr<const ConfigSnapshot> Config::snapshot() const {
+    return snapshot_.load(std::memory_order_acquire);
 }
 
-void Config::addFeed(const FeedInfo& feed) {
-    for (const auto& f : feeds_) {
-        if (f.url == feed.url) return;
+void Config::update(const std::function<bool(ConfigSnapshot&)>& change) {
+    {
+        std::lock_guard<std::mutex> lock(updateMutex_);
+        auto next = std::make_shared<ConfigSnapshot>(*snapshot());
+        if (!change(*next)) return;
+        snapshot_.store(std::move(next), std::memory_order_release);
     }
-    feeds_.push_back(feed);
     save();
 }
 
+// Feed management
+std::shared_ptr<const std::vector<FeedInfo>> Config::getFeeds() const {
+    auto s = snapshot();
+    return {s, &s->feeds};
+}
+
+void Config::addFeed(const FeedInfo& feed) {
+    update([&](ConfigSnapshot& s) {
+        for (const auto& f : s.feeds) {
+            if (f.url == feed.url) return false;
+        }
+        s.feeds.push_back(feed);
+        return true;
+    });
+}
+
 void Config::updateFeed(const std::string& url, const FeedInfo& feed) {
-    for (auto& f : feeds_) {
-        if (f.url == url) {
-            f = feed;
-            save();
-            return;
+    update([&](ConfigSnapshot& s) {
+        for (auto& f : s.feeds) {
+            if (f.url == url) {
+                f = feed;
+                return true;
+            }
         }
-    }
+        return false;
+    });
 }
 
 void Config::removeFeed(const std::string& url) {
-    feeds_.erase(std::remove_if(feeds_.begin(), feeds_.end(),
-        [&url](const FeedInfo& f) { return f.url == url; }), feeds_.end());
-    save();
+    update([&](ConfigSnapshot& s) {
+        s.feeds.erase(std::remove_if(s.feeds.begin(), s.feeds.end(),
+            [&url](const FeedInfo& f) { return f.url == url; }), s.feeds.end());
+        return true;
+    });
 }
 
 std::vector<FeedInfo> Config::getFeedsByCategory(const std::string& category) const {
-    if (category == "all") return feeds_;
+    auto s = snapshot();
+    if (category == "all") return s->feeds;
     
     std::vector<FeedInfo> result;
-    for (const auto& f : feeds_) {
+    for (const auto& f : s->feeds) {
         if (f.category == category && f.enabled) {
             result.push_back(f);
         }
@@ -515,8 +763,9 @@ std::vector<FeedInfo> Config::getFeedsByCategory(const std::string& category) co
 
 // Legacy support
 std::vector<std::string> Config::getRSSFeeds() const {
+    auto s = snapshot();
     std::vector<std::string> urls;
-    for (const auto& f : feeds_) {
+    for (const auto& f : s->feeds) {
         if (f.enabled) urls.push_back(f.url);
     }
     return urls;
@@ -536,59 +785,75 @@ void Config::removeRSSFeed(const std::string& url) {
 }
 
 // Category management
-std::vector<Category> Config::getCategories() const {
-    auto cats = categories_;
-    std::sort(cats.begin(), cats.end(), [](const Category& a, const Category& b) {
-        return a.order < b.order;
-    });
-    return cats;
+std::shared_ptr<const std::vector<Category>> Config::getCategories() const {
+    auto s = snapshot();
+    return {s, &s->categories};
 }
 
 void Config::addCategory(const Category& category) {
-    for (const auto& c : categories_) {
-        if (c.id == category.id) return;
-    }
-    categories_.push_back(category);
-    save();
+    update([&](ConfigSnapshot& s) {
+        for (const auto& c : s.categories) {
+            if (c.id == category.id) return false;
+        }
+        s.categories.push_back(category);
+        sortCategories(s.categories);
+        return true;
+    });
 }
 
 void Config::updateCategory(const std::string& id, const Category& category) {
-    for (auto& c : categories_) {
-        if (c.id == id) {
-            c = category;
-            save();
-            return;
+    update([&](ConfigSnapshot& s) {
+        for (auto& c : s.categories) {
+            if (c.id == id) {
+                c = category;
+                sortCategories(s.categories);
+                return true;
+            }
         }
-    }
+        return false;
+    });
 }
 
 void Config::removeCategory(const std::string& id) {
     if (id == "all" || id == "uncategorized" || id == "saved") return;
     
-    for (auto& f : feeds_) {
-        if (f.category == id) {
-            f.category = "uncategorized";
+    update([&](ConfigSnapshot& s) {
+        for (auto& f : s.feeds) {
+            if (f.category == id) {
+                f.category = "uncategorized";
+            }
         }
-    }
-    
-    categories_.erase(std::remove_if(categories_.begin(), categories_.end(),
-        [&id](const Category& c) { return c.id == id; }), categories_.end());
-    save();
+        
+        s.categories.erase(std::remove_if(s.categories.begin(), s.categories.end(),
+            [&id](const Category& c) { return c.id == id; }), s.categories.end());
+        return true;
+    });
 }
 
 // Read status
-bool Config::isArticleRead(const std::string& articleId) const {
-    return readArticles_.find(articleId) != readArticles_.end();
+bool Config::isArticleRead(std::string_view articleId) const {
+    return readArticles_.contains(articleId);
 }
 
 void Config::markArticleRead(const std::string& articleId) {
-    readArticles_.insert(articleId);
-    save();
+    if (readArticles_.insert(ReadSet::hash(articleId), ReadSet::today())) journal('R', articleId);
 }
 
 void Config::markArticleUnread(const std::string& articleId) {
-    readArticles_.erase(articleId);
-    save();
+    if (readArticles_.erase(ReadSet::hash(articleId))) journal('U', articleId);
+}
+
+void Config::noteArticlesSeen(const std::vector<std::string_view>& articleIds) {
+    ReadSet::Day today = ReadSet::today();
+    bool changed = readSeenDay_ != today;
+    readSeenDay_ = today;
+    for (auto id : articleIds) changed = readArticles_.touch(ReadSet::hash(id), today) || changed;
+    // Whatever is still offered was just bumped, so what is left is old.
+    if (today > kReadExpiryDays) {
+        changed = readArticles_.expire(static_cast<ReadSet::Day>(today - kReadExpiryDays)) > 0 || changed;
+    }
+    // At most once a day per refresh, since days only change daily.
+    if (changed) save();
 }
 
 void Config::markAllRead(const std::string& feedUrl) {
@@ -596,27 +861,17 @@ void Config::markAllRead(const std::string& feedUrl) {
     save();
 }
 
-std::set<std::string> Config::getReadArticles() const {
-    return readArticles_;
-}
-
 // Save for later
 bool Config::isArticleSaved(const std::string& articleId) const {
     return savedArticles_.find(articleId) != savedArticles_.end();
 }
 
 void Config::saveArticle(const std::string& articleId) {
-    savedArticles_.insert(articleId);
-    save();
+    if (savedArticles_.insert(articleId).second) journal('S', articleId);
 }
 
 void Config::unsaveArticle(const std::string& articleId) {
-    savedArticles_.erase(articleId);
-    save();
-}
-
-std::set<std::string> Config::getSavedArticles() const {
-    return savedArticles_;
+    if (savedArticles_.erase(articleId)) journal('X', articleId);
 }
 
 // Category expansion state
@@ -626,42 +881,47 @@ bool Config::isCategoryExpanded(const std::string& categoryId) const {
 
 void Config::setCategoryExpanded(const std::string& categoryId, bool expanded) {
     if (expanded) {
-        expandedCategories_.insert(categoryId);
+        if (expandedCategories_.insert(categoryId).second) journal('E', categoryId);
     } else {
-        expandedCategories_.erase(categoryId);
+        if (expandedCategories_.erase(categoryId)) journal('C', categoryId);
     }
-    save();
 }
 
 // Weather locations
-std::vector<std::string> Config::getWeatherLocations() const {
-    return weatherLocations_;
+std::shared_ptr<const std::vector<std::string>> Config::getWeatherLocations() const {
+    auto s = snapshot();
+    return {s, &s->weatherLocations};
 }
 
 void Config::addWeatherLocation(const std::string& location) {
-    // Check if already exists
-    for (const auto& loc : weatherLocations_) {
-        if (loc == location) return;
-    }
-    weatherLocations_.push_back(location);
-    save();
+    update([&](ConfigSnapshot& s) {
+        // Check if already exists
+        for (const auto& loc : s.weatherLocations) {
+            if (loc == location) return false;
+        }
+        s.weatherLocations.push_back(location);
+        return true;
+    });
 }
 
 void Config::removeWeatherLocation(const std::string& location) {
-    weatherLocations_.erase(
-        std::remove(weatherLocations_.begin(), weatherLocations_.end(), location),
-        weatherLocations_.end());
-    // Ensure at least one location
-    if (weatherLocations_.empty()) {
-        weatherLocations_.push_back("auto");
-    }
-    save();
+    update([&](ConfigSnapshot& s) {
+        s.weatherLocations.erase(
+            std::remove(s.weatherLocations.begin(), s.weatherLocations.end(), location),
+            s.weatherLocations.end());
+        // Ensure at least one location
+        if (s.weatherLocations.empty()) {
+            s.weatherLocations.push_back("auto");
+        }
+        return true;
+    });
 }
 
 // Legacy single location support
 std::string Config::getWeatherLocation() const {
-    if (weatherLocations_.empty()) return "auto";
-    return weatherLocations_[0];
+    auto s = snapshot();
+    if (s->weatherLocations.empty()) return "auto";
+    return s->weatherLocations[0];
 }
 
 void Config::setWeatherLocation(const std::string& location) {
@@ -669,76 +929,98 @@ void Config::setWeatherLocation(const std::string& location) {
 }
 
 TempUnit Config::getTempUnit() const {
-    return tempUnit_;
+    return snapshot()->tempUnit;
 }
 
 void Config::setTempUnit(TempUnit unit) {
-    tempUnit_ = unit;
-    save();
+    update([&](ConfigSnapshot& s) {
+        s.tempUnit = unit;
+        return true;
+    });
 }
 
-std::vector<std::string> Config::getStockSymbols() const {
-    return stockSymbols_;
+std::shared_ptr<const std::vector<std::string>> Config::getStockSymbols() const {
+    auto s = snapshot();
+    return {s, &s->stockSymbols};
 }
 
 void Config::addStockSymbol(const std::string& symbol) {
-    for (const auto& s : stockSymbols_) {
-        if (s == symbol) return;
-    }
-    stockSymbols_.push_back(symbol);
-    save();
+    update([&](ConfigSnapshot& s) {
+        for (const auto& sym : s.stockSymbols) {
+            if (sym == symbol) return false;
+        }
+        s.stockSymbols.push_back(symbol);
+        return true;
+    });
 }
 
 void Config::removeStockSymbol(const std::string& symbol) {
-    stockSymbols_.erase(std::remove(stockSymbols_.begin(), stockSymbols_.end(), symbol), stockSymbols_.end());
-    save();
+    update([&](ConfigSnapshot& s) {
+        s.stockSymbols.erase(std::remove(s.stockSymbols.begin(), s.stockSymbols.end(), symbol),
+                             s.stockSymbols.end());
+        return true;
+    });
 }
 
 // Layout preference
 LayoutMode Config::getLayoutMode() const {
-    return layoutMode_;
+    return snapshot()->layoutMode;
 }
 
 void Config::setLayoutMode(LayoutMode mode) {
-    layoutMode_ = mode;
-    save();
+    update([&](ConfigSnapshot& s) {
+        s.layoutMode = mode;
+        return true;
+    });
+}
+
+int Config::getImageCacheMB() const {
+    return snapshot()->imageCacheMB;
 }
 
 // Theme preferences
 ThemePreferences Config::getThemePreferences() const {
-    return themePrefs_;
+    return snapshot()->themePrefs;
 }
 
 void Config::setThemePreferences(const ThemePreferences& prefs) {
-    themePrefs_ = prefs;
-    save();
+    update([&](ConfigSnapshot& s) {
+        s.themePrefs = prefs;
+        return true;
+    });
 }
 
 ThemeMode Config::getThemeMode() const {
-    return themePrefs_.mode;
+    return snapshot()->themePrefs.mode;
 }
 
 void Config::setThemeMode(ThemeMode mode) {
-    themePrefs_.mode = mode;
-    save();
+    update([&](ConfigSnapshot& s) {
+        s.themePrefs.mode = mode;
+        return true;
+    });
 }
 
 ColorScheme Config::getColorScheme() const {
-    return themePrefs_.scheme;
+    return snapshot()->themePrefs.scheme;
 }
 
 void Config::setColorScheme(ColorScheme scheme) {
-    themePrefs_.scheme = scheme;
-    save();
+    update([&](ConfigSnapshot& s) {
+        s.themePrefs.scheme = scheme;
+        return true;
+    });
 }
 
 std::string Config::getCustomAccentColor() const {
-    return themePrefs_.customAccentColor;
+    return snapshot()->themePrefs.customAccentColor;
 }
 
 void Config::setCustomAccentColor(const std::string& color) {
-    themePrefs_.customAccentColor = color;
-    save();
+    update([&](ConfigSnapshot& s) {
+        s.themePrefs.customAccentColor = color;
+        return true;
+    });
 }
 
 }
@@ -0,0 +1,177 @@
+#include "utils/DateParser.hpp"
+
+namespace InfoDash {
+
+struct Cursor {
+    const char* p;
+    const char* end;
+
+    bool atEnd() const { return p == end; }
+    char peek() const { return p < end ? *p : '\0'; }
+    static bool isDigit(char c) { return c >= '0' && c <= '9'; }
+    static bool isAlpha(char c) { return (c | 0x20) >= 'a' && (c | 0x20) <= 'z'; }
+
+    void skipSpace() {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')) ++p;
+    }
+
+    // Reads between minDigits and maxDigits digits; returns how many were read.
+    int number(int& value, int minDigits, int maxDigits) {
+        int n = 0;
+        value = 0;
+        while (p < end && n < maxDigits && isDigit(*p)) {
+            value = value * 10 + (*p++ - '0');
+            ++n;
+        }
+        return n >= minDigits ? n : 0;
+    }
+
+    bool accept(char c) {
+        if (peek() != c) return false;
+        ++p;
+        return true;
+    }
+};
+
+// Days since 1970-01-01 in the proleptic Gregorian calendar (H. Hinnant).
+static int64_t daysFromCivil(int64_t y, int m, int d) {
+    y -= m <= 2;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const int64_t yoe = y - era * 400;
+    const int64_t doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+static int64_t toEpoch(int year, int month, int day, int hour, int minute, int second, int offsetSeconds) {
+    if (month < 1 || month > 12 || day < 1 || day > 31) return 0;
+    if (hour > 24 || minute > 59 || second > 60) return 0;
+    int64_t t = daysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second;
+    return t - offsetSeconds;
+}
+
+// Month from its first three letters, case-insensitive; 0 if unknown.
+static int monthFromName(Cursor& c) {
+    static const char names[] = "janfebmaraprmayjunjulaugsepoctnovdec";
+    if (c.end - c.p < 3) return 0;
+    char m[3] = {static_cast<char>(c.p[0] | 0x20), static_cast<char>(c.p[1] | 0x20),
+                 static_cast<char>(c.p[2] | 0x20)};
+    for (int i = 0; i < 12; ++i) {
+        if (names[i * 3] == m[0] && names[i * 3 + 1] == m[1] && names[i * 3 + 2] == m[2]) {
+            c.p += 3;
+            while (!c.atEnd() && Cursor::isAlpha(*c.p)) ++c.p;  // "October", "Sept."
+            c.accept('.');
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+// "+hhmm", "+hh:mm", "+hh"; sets seconds east of UTC.
+static bool numericOffset(Cursor& c, int& offset) {
+    char sign = c.peek();
+    if (sign != '+' && sign != '-') return false;
+    ++c.p;
+    int hh = 0, mm = 0;
+    int n = c.number(hh, 2, 4);
+    if (n == 4) {
+        mm = hh % 100;
+        hh /= 100;
+    } else if (n == 2) {
+        if (c.accept(':') && !c.number(mm, 2, 2)) return false;
+    } else {
+        return false;
+    }
+    offset = (hh * 3600 + mm * 60) * (sign == '-' ? -1 : 1);
+    return true;
+}
+
+// RFC 822 zone: numeric offset or a name. Unknown names (military letters,
+// local abbreviations) are taken as UTC rather than rejecting the date.
+static void rfc822Zone(Cursor& c, int& offset) {
+    offset = 0;
+    c.skipSpace();
+    if (numericOffset(c, offset)) return;
+    const char* start = c.p;
+    while (!c.atEnd() && Cursor::isAlpha(*c.p)) ++c.p;
+    std::string_view zone(start, static_cast<size_t>(c.p - start));
+    if (zone.size() != 3 || (zone[2] | 0x20) != 't') return;
+    int base = 0;
+    switch (zone[0] | 0x20) {
+        case 'e': base = -5; break;
+        case 'c': base = -6; break;
+        case 'm': base = -7; break;
+        case 'p': base = -8; break;
+        default: return;
+    }
+    char kind = zone[1] | 0x20;
+    if (kind == 'd') base += 1;
+    else if (kind != 's') return;
+    offset = base * 3600;
+}
+
+static int64_t parseRfc822(Cursor& c) {
+    // Optional weekday: "Wed," or "Wednesday,".
+    if (Cursor::isAlpha(c.peek())) {
+        while (!c.atEnd() && Cursor::isAlpha(*c.p)) ++c.p;
+        c.accept(',');
+        c.skipSpace();
+    }
+
+    int day = 0, year = 0, hour = 0, minute = 0, second = 0;
+    if (!c.number(day, 1, 2)) return 0;
+    c.skipSpace();
+    c.accept('-');
+    int month = monthFromName(c);
+    if (!month) return 0;
+    c.skipSpace();
+    c.accept('-');
+    int digits = c.number(year, 2, 4);
+    if (digits == 2) year += year < 50 ? 2000 : 1900;
+    else if (digits != 4) return 0;
+
+    c.skipSpace();
+    if (c.number(hour, 1, 2)) {
+        if (!c.accept(':') || !c.number(minute, 2, 2)) return 0;
+        if (c.accept(':') && !c.number(second, 2, 2)) return 0;
+    }
+    int offset = 0;
+    rfc822Zone(c, offset);
+    return toEpoch(year, month, day, hour, minute, second, offset);
+}
+
+static int64_t parseIso8601(Cursor& c) {
+    int year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0;
+    if (!c.number(year, 4, 4) || !c.accept('-') || !c.number(month, 2, 2) ||
+        !c.accept('-') || !c.number(day, 2, 2)) {
+        return 0;
+    }
+
+    int offset = 0;
+    char sep = c.peek();
+    if (sep == 'T' || sep == 't' || sep == ' ') {
+        ++c.p;
+        if (!c.number(hour, 2, 2) || !c.accept(':') || !c.number(minute, 2, 2)) return 0;
+        if (c.accept(':')) {
+            if (!c.number(second, 2, 2)) return 0;
+            if (c.accept('.') || c.accept(',')) {
+                while (!c.atEnd() && Cursor::isDigit(*c.p)) ++c.p;
+            }
+        }
+        c.skipSpace();
+        if (!c.accept('Z') && !c.accept('z')) numericOffset(c, offset);
+    }
+    return toEpoch(year, month, day, hour, minute, second, offset);
+}
+
+int64_t DateParser::parse(std::string_view text) {
+    Cursor c{text.data(), text.data() + text.size()};
+    c.skipSpace();
+    if (c.end - c.p >= 5 && Cursor::isDigit(c.p[0]) && Cursor::isDigit(c.p[1]) &&
+        Cursor::isDigit(c.p[2]) && Cursor::isDigit(c.p[3]) && c.p[4] == '-') {
+        return parseIso8601(c);
+    }
+    return parseRfc822(c);
+}
+
+}
@@ -0,0 +1,149 @@
+#include "utils/DiskCache.hpp"
+#include "utils/Config.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace InfoDash {
+
+DiskCache& DiskCache::getInstance() {
+    static DiskCache instance("http", kHttpBytes);
+    return instance;
+}
+
+DiskCache& DiskCache::thumbnails() {
+    static DiskCache instance("thumbs", kThumbnailBytes);
+    return instance;
+}
+
+DiskCache::DiskCache(const std::string& subdir, uint64_t maxBytes)
+    : dir_(Config::getInstance().getCachePath() + "/" + subdir), maxBytes_(maxBytes) {}
+
+// FNV-1a; collisions are caught by the key stored in the file header.
+std::string DiskCache::fileName(const std::string& key) const {
+    uint64_t hash = 1469598103934665603ull;
+    for (unsigned char c : key) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    char buf[17];
+    snprintf(buf, sizeof(buf), "%016llx", static_cast<unsigned long long>(hash));
+    return buf;
+}
+
+// Recency is seeded from file modification times, which get() and put()
+// keep current; after that it is tracked in memory.
+void DiskCache::loadIndex() {
+    if (indexed_) return;
+    indexed_ = true;
+
+    std::error_code ec;
+    fs::create_directories(dir_, ec);
+
+    std::vector<std::pair<fs::file_time_type, std::string>> files;
+    for (const auto& entry : fs::directory_iterator(dir_, ec)) {
+        if (!entry.is_regular_file(ec)) continue;
+        std::string name = entry.path().filename().string();
+        if (name.find('.') != std::string::npos) {
+            fs::remove(entry.path(), ec);  // leftover temp file
+            continue;
+        }
+        files.emplace_back(entry.last_write_time(ec), name);
+    }
+    std::sort(files.begin(), files.end());
+    for (const auto& [mtime, name] : files) {
+        uint64_t size = fs::file_size(fs::path(dir_) / name, ec);
+        if (ec) continue;
+        index_[name] = {size, ++clock_};
+        totalBytes_ += size;
+    }
+    evict();
+}
+
+void DiskCache::evict() {
+    if (totalBytes_ <= maxBytes_) return;
+
+    std::vector<std::pair<int64_t, std::string>> order;
+    order.reserve(index_.size());
+    for (const auto& [name, entry] : index_) order.emplace_back(entry.lastUse, name);
+    std::sort(order.begin(), order.end());
+
+    // Trim to 90% so a steady trickle of writes does not evict on every put.
+    uint64_t target = maxBytes_ / 10 * 9;
+    std::error_code ec;
+    for (const auto& [lastUse, name] : order) {
+        if (totalBytes_ <= target) break;
+        fs::remove(fs::path(dir_) / name, ec);
+        totalBytes_ -= index_[name].size;
+        index_.erase(name);
+    }
+}
+
+bool DiskCache::get(const std::string& key, std::string& value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    loadIndex();
+
+    std::string name = fileName(key);
+    auto it = index_.find(name);
+    if (it == index_.end()) return false;
+
+    fs::path path = fs::path(dir_) / name;
+    std::ifstream in(path, std::ios::binary);
+    std::string storedKey;
+    if (!in || !std::getline(in, storedKey) || storedKey != key) return false;
+
+    value.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    it->second.lastUse = ++clock_;
+    std::error_code ec;
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+    return true;
+}
+
+void DiskCache::put(const std::string& key, const std::string& value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    loadIndex();
+
+    std::string name = fileName(key);
+    fs::path path = fs::path(dir_) / name;
+    fs::path tmp = path;
+    tmp += ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        if (!out) return;
+        out << key << '\n';
+        out.write(value.data(), static_cast<std::streamsize>(value.size()));
+        if (!out) return;
+    }
+    std::error_code ec;
+    fs::rename(tmp, path, ec);
+    if (ec) {
+        fs::remove(tmp, ec);
+        return;
+    }
+
+    uint64_t size = key.size() + 1 + value.size();
+    auto it = index_.find(name);
+    if (it != index_.end()) totalBytes_ -= it->second.size;
+    index_[name] = {size, ++clock_};
+    totalBytes_ += size;
+    evict();
+}
+
+void DiskCache::remove(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    loadIndex();
+
+    std::string name = fileName(key);
+    auto it = index_.find(name);
+    if (it == index_.end()) return;
+    std::error_code ec;
+    fs::remove(fs::path(dir_) / name, ec);
+    totalBytes_ -= it->second.size;
+    index_.erase(it);
+}
+
+}
@@ -1,7 +1,8 @@
 #include "utils/HtmlParser.hpp"
 #include <libxml/parser.h>
 #include <libxml/xpathInternals.h>
-#include <regex>
+#include <algorithm>
+#include <cstdint>
 
 namespace InfoDash {
 
@@ -69,17 +70,226 @@ std::string HtmlParser::getAttribute(const std::string& xpath, const std::string
     return value;
 }
 
-// Extract image URL from HTML content (description field often contains images)
-static std::string extractImageFromHtml(const std::string& html) {
-    // Try to find img src
-    std::regex imgRegex(R"(<img[^>]+src\s*=\s*[\"']([^\"']+)[\"'])");
-    std::smatch match;
-    if (std::regex_search(html, match, imgRegex)) {
-        return match[1].str();
+static void appendUtf8(std::string& out, uint32_t cp) {
+    if (cp == 0 || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) cp = 0xFFFD;
+    if (cp < 0x80) {
+        out += static_cast<char>(cp);
+    } else if (cp < 0x800) {
+        out += static_cast<char>(0xC0 | (cp >> 6));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        out += static_cast<char>(0xE0 | (cp >> 12));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (cp >> 18));
+        out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+}
+
+// Decode the entity starting at html[pos] == '&' into `out`. Returns the
+// number of input bytes consumed, or 0 if it is not a recognised entity.
+static size_t decodeEntity(std::string_view html, size_t pos, std::string& out) {
+    size_t semi = html.find(';', pos + 1);
+    if (semi == std::string_view::npos || semi - pos > 10) return 0;
+    std::string_view name = html.substr(pos + 1, semi - pos - 1);
+    if (name.empty()) return 0;
+
+    if (name[0] == '#') {
+        uint32_t cp = 0;
+        bool hex = name.size() > 1 && (name[1] == 'x' || name[1] == 'X');
+        size_t i = hex ? 2 : 1;
+        if (i >= name.size()) return 0;
+        for (; i < name.size(); ++i) {
+            char c = name[i];
+            uint32_t digit;
+            if (c >= '0' && c <= '9') digit = c - '0';
+            else if (hex && c >= 'a' && c <= 'f') digit = c - 'a' + 10;
+            else if (hex && c >= 'A' && c <= 'F') digit = c - 'A' + 10;
+            else return 0;
+            cp = cp * (hex ? 16 : 10) + digit;
+            if (cp > 0x10FFFF) cp = 0x110000;  // clamp; reported as U+FFFD
+        }
+        appendUtf8(out, cp);
+        return semi - pos + 1;
+    }
+
+    static const struct { std::string_view name; const char* text; } kNamed[] = {
+        {"amp", "&"}, {"lt", "<"}, {"gt", ">"}, {"quot", "\""}, {"apos", "'"},
+        {"nbsp", " "}, {"ndash", "–"}, {"mdash", "—"}, {"hellip", "…"},
+        {"lsquo", "‘"}, {"rsquo", "’"}, {"ldquo", "“"}, {"rdquo", "”"},
+        {"copy", "©"}, {"reg", "®"}, {"trade", "™"}, {"laquo", "«"},
+        {"raquo", "»"}, {"bull", "•"}, {"middot", "·"}, {"deg", "°"},
+    };
+    for (const auto& e : kNamed) {
+        if (e.name == name) {
+            out += e.text;
+            return semi - pos + 1;
+        }
+    }
+    return 0;
+}
+
+static bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static char lower(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + 32) : c;
+}
+
+// Pull the src attribute out of the tag body between '<' and '>'. Only called
+// for tags whose name is "img".
+static std::string imgSrc(std::string_view tag) {
+    size_t i = 3;  // past "img"
+    while (i < tag.size()) {
+        while (i < tag.size() && (isSpace(tag[i]) || tag[i] == '/')) ++i;
+        size_t nameStart = i;
+        while (i < tag.size() && !isSpace(tag[i]) && tag[i] != '=' && tag[i] != '/') ++i;
+        std::string_view name = tag.substr(nameStart, i - nameStart);
+        while (i < tag.size() && isSpace(tag[i])) ++i;
+
+        std::string_view value;
+        if (i < tag.size() && tag[i] == '=') {
+            ++i;
+            while (i < tag.size() && isSpace(tag[i])) ++i;
+            if (i < tag.size() && (tag[i] == '"' || tag[i] == '\'')) {
+                char quote = tag[i++];
+                size_t end = tag.find(quote, i);
+                if (end == std::string_view::npos) end = tag.size();
+                value = tag.substr(i, end - i);
+                i = end + 1;
+            } else {
+                size_t start = i;
+                while (i < tag.size() && !isSpace(tag[i])) ++i;
+                value = tag.substr(start, i - start);
+            }
+        }
+        if (name.size() == 3 && lower(name[0]) == 's' && lower(name[1]) == 'r' &&
+            lower(name[2]) == 'c' && !value.empty()) {
+            std::string src;
+            src.reserve(value.size());
+            for (size_t j = 0; j < value.size(); ++j) {
+                size_t used = value[j] == '&' ? decodeEntity(value, j, src) : 0;
+                if (used) j += used - 1;
+                else src += value[j];
+            }
+            return src;
+        }
+        if (name.empty()) ++i;
     }
     return "";
 }
 
+// The scanning kernel behind htmlToText and extractImageFromHtml. One pass,
+// no regex, output reserved up front; stops as soon as neither the text
+// limit nor the image search needs more input.
+static void scanHtml(std::string_view html, std::string* text, size_t maxBytes, std::string* image) {
+    bool wantText = text != nullptr;
+    bool wantImage = image != nullptr;
+    std::string out;
+    if (wantText) out.reserve(std::min(html.size(), maxBytes + 8));
+    size_t lastNonSpace = 0;    // out length up to the last non-space byte
+    bool noCloseAfter = false;  // no '>' left in the input
+
+    size_t i = 0;
+    while (i < html.size() && (wantText || wantImage)) {
+        char c = html[i];
+        if (c == '<' && !noCloseAfter) {
+            if (html.compare(i, 4, "<!--") == 0) {
+                size_t end = html.find("-->", i + 4);
+                i = (end == std::string_view::npos) ? html.size() : end + 3;
+                continue;
+            }
+            size_t close = html.find('>', i + 1);
+            if (close == std::string_view::npos) {
+                // No tag can follow, so neither can an image.
+                noCloseAfter = true;
+                wantImage = false;
+                continue;  // re-read '<' as text
+            }
+            std::string_view tag = html.substr(i + 1, close - i - 1);
+            if (wantImage && tag.size() > 3 && lower(tag[0]) == 'i' && lower(tag[1]) == 'm' &&
+                lower(tag[2]) == 'g' && isSpace(tag[3])) {
+                std::string src = imgSrc(tag);
+                if (!src.empty()) {
+                    *image = std::move(src);
+                    wantImage = false;
+                }
+            }
+            i = close + 1;
+            continue;
+        }
+
+        if (!wantText) {
+            size_t next = html.find('<', i);
+            i = (next == std::string_view::npos) ? html.size() : next;
+            continue;
+        }
+        if (out.empty() && isSpace(c)) {
+            ++i;
+            continue;
+        }
+        size_t used = (c == '&') ? decodeEntity(html, i, out) : 0;
+        if (used) {
+            i += used;
+        } else {
+            out += c;
+            ++i;
+        }
+        if (!isSpace(out.back())) lastNonSpace = out.size();
+        if (lastNonSpace > maxBytes) wantText = false;
+    }
+
+    if (!text) return;
+    out.resize(lastNonSpace);
+    if (out.size() > maxBytes) {
+        size_t cut = maxBytes;
+        while (cut > 0 && (static_cast<unsigned char>(out[cut]) & 0xC0) == 0x80) --cut;
+        out.resize(cut);
+        out += "...";
+    }
+    *text = std::move(out);
+}
+
+std::string HtmlParser::htmlToText(std::string_view html, size_t maxBytes, std::string* firstImage) {
+    std::string text;
+    scanHtml(html, &text, maxBytes, firstImage);
+    return text;
+}
+
+// Extract image URL from HTML content (description field often contains images)
+std::string HtmlParser::extractImageFromHtml(const std::string& html) {
+    std::string image;
+    scanHtml(html, nullptr, 0, &image);
+    return image;
+}
+
+// Strip HTML from a description for display
+std::string HtmlParser::summarizeDescription(const std::string& html) {
+    return htmlToText(html, kDescriptionLimit);
+}
+
+std::string HtmlParser::resolveUrl(const std::string& base, const std::string& href) {
+    if (href.rfind("http://", 0) == 0 || href.rfind("https://", 0) == 0) return href;
+    size_t s = base.find("://");
+    std::string scheme = "https";
+    std::string host = base;
+    if (s != std::string::npos) {
+        scheme = base.substr(0, s);
+        size_t start = s + 3;
+        size_t end = base.find('/', start);
+        host = (end == std::string::npos) ? base.substr(start) : base.substr(start, end - start);
+    }
+    if (href.rfind("//", 0) == 0) return scheme + ":" + href;
+    if (href.rfind("/", 0) == 0) return scheme + "://" + host + href;
+    size_t pos = base.rfind('/');
+    std::string basepath = (pos == std::string::npos) ? base : base.substr(0, pos + 1);
+    return basepath + href;
+}
+
 std::vector<std::map<std::string, std::string>> HtmlParser::parseRSSItems(const std::string& xml) {
     std::vector<std::map<std::string, std::string>> items;
     xmlDocPtr doc = xmlReadMemory(xml.c_str(), xml.size(), nullptr, "UTF-8",
@@ -150,6 +360,9 @@ std::vector<std::map<std::string, std::string>> HtmlParser::parseRSSItems(const
                 else if (name == "creator" || name == "author") {
                     item["author"] = content;
                 }
+                else if (name == "guid" || name == "id") {
+                    item["guid"] = content;
+                }
                 else if (name == "enclosure") {
                     // RSS enclosure for media
                     xmlChar* type = xmlGetProp(child, reinterpret_cast<const xmlChar*>("type"));
@@ -185,31 +398,20 @@ std::vector<std::map<std::string, std::string>> HtmlParser::parseRSSItems(const
                 }
             }
             
-            // If no image found, try to extract from description HTML
-            if (item["imageUrl"].empty() && !descriptionHtml.empty()) {
-                item["imageUrl"] = extractImageFromHtml(descriptionHtml);
+            // If no image found, try to extract from description HTML; when
+            // that is the description itself, one scan does both jobs.
+            bool needImage = item["imageUrl"].empty() && !descriptionHtml.empty();
+            std::string& desc = item["description"];
+            if (!desc.empty()) {
+                if (needImage && desc == descriptionHtml) {
+                    desc = htmlToText(desc, kDescriptionLimit, &item["imageUrl"]);
+                    needImage = false;
+                } else {
+                    desc = summarizeDescription(desc);
+                }
             }
-            
-            // Strip HTML from description for display
-            if (!item["description"].empty()) {
-                std::string& desc = item["description"];
-                // Simple HTML tag removal
-                std::regex tagRegex("<[^>]*>");
-                desc = std::regex_replace(desc, tagRegex, "");
-                // Decode common entities
-                size_t pos;
-                while ((pos = desc.find("&amp;")) != std::string::npos) desc.replace(pos, 5, "&");
-                while ((pos = desc.find("&lt;")) != std::string::npos) desc.replace(pos, 4, "<");
-                while ((pos = desc.find("&gt;")) != std::string::npos) desc.replace(pos, 4, ">");
-                while ((pos = desc.find("&quot;")) != std::string::npos) desc.replace(pos, 6, "\"");
-                while ((pos = desc.find("&nbsp;")) != std::string::npos) desc.replace(pos, 6, " ");
-                while ((pos = desc.find("&#39;")) != std::string::npos) desc.replace(pos, 5, "'");
-                // Trim
-                size_t start = desc.find_first_not_of(" \t\n\r");
-                size_t end = desc.find_last_not_of(" \t\n\r");
-                if (start != std::string::npos) desc = desc.substr(start, end - start + 1);
-                // Truncate long descriptions
-                if (desc.length() > 200) desc = desc.substr(0, 200) + "...";
+            if (needImage) {
+                item["imageUrl"] = extractImageFromHtml(descriptionHtml);
             }
             
             if (!item["title"].empty()) items.push_back(item);
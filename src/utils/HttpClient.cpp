@@ -1,95 +1,74 @@
 #include "utils/HttpClient.hpp"
-#include <curl/curl.h>
-#include <thread>
+#include "utils/HttpEngine.hpp"
+#include "utils/DiskCache.hpp"
+#include <memory>
+#include <strings.h>
 
 namespace InfoDash {
 
-HttpClient::HttpClient() 
-    : userAgent_("Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36"), timeout_(30) {
-    curl_global_init(CURL_GLOBAL_ALL);
-}
+HttpClient::HttpClient()
+    : userAgent_("Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36"), timeout_(30) {}
 
-HttpClient::~HttpClient() { curl_global_cleanup(); }
+HttpClient::~HttpClient() = default;
 
-size_t HttpClient::writeCallback(void* contents, size_t size, size_t nmemb, void* userp) {
-    auto* str = static_cast<std::string*>(userp);
-    str->append(static_cast<char*>(contents), size * nmemb);
-    return size * nmemb;
+std::string HttpClient::Response::header(const std::string& name) const {
+    for (const auto& [key, value] : headers) {
+        if (strcasecmp(key.c_str(), name.c_str()) == 0) return value;
+    }
+    return "";
 }
 
-size_t HttpClient::writeBytesCallback(void* contents, size_t size, size_t nmemb, void* userp) {
-    auto* vec = static_cast<std::vector<unsigned char>*>(userp);
-    auto* data = static_cast<unsigned char*>(contents);
-    vec->insert(vec->end(), data, data + size * nmemb);
-    return size * nmemb;
+HttpClient::Request HttpClient::makeRequest(const std::string& url) const {
+    Request request;
+    request.url = url;
+    request.userAgent = userAgent_;
+    request.timeoutSeconds = timeout_;
+    return request;
 }
 
-size_t HttpClient::headerCallback(char* buffer, size_t size, size_t nitems, void* userdata) {
-    auto* headers = static_cast<std::map<std::string, std::string>*>(userdata);
-    std::string header(buffer, size * nitems);
-    size_t pos = header.find(':');
-    if (pos != std::string::npos) {
-        std::string key = header.substr(0, pos);
-        std::string val = header.substr(pos + 1);
-        val.erase(0, val.find_first_not_of(" \t"));
-        val.erase(val.find_last_not_of(" \t\r\n") + 1);
-        (*headers)[key] = val;
-    }
-    return size * nitems;
+std::future<HttpClient::Response> HttpClient::fetch(const std::string& url) {
+    auto promise = std::make_shared<std::promise<Response>>();
+    auto future = promise->get_future();
+    HttpEngine::getInstance().submit(makeRequest(url), [promise](Response response) {
+        promise->set_value(std::move(response));
+    });
+    return future;
 }
 
 HttpClient::Response HttpClient::get(const std::string& url) {
-    Response response{0, "", {}, false, ""};
-    CURL* curl = curl_easy_init();
-    if (!curl) { response.error = "CURL init failed"; return response; }
-
-    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeCallback);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response.body);
-    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, headerCallback);
-    curl_easy_setopt(curl, CURLOPT_HEADERDATA, &response.headers);
-    curl_easy_setopt(curl, CURLOPT_USERAGENT, userAgent_.c_str());
-    curl_easy_setopt(curl, CURLOPT_TIMEOUT, timeout_);
-    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
-    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 1L);
-    curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, "gzip, deflate");
-
-    CURLcode res = curl_easy_perform(curl);
-    if (res == CURLE_OK) {
-        long httpCode;
-        curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
-        response.statusCode = static_cast<int>(httpCode);
-        response.success = (httpCode >= 200 && httpCode < 300);
-    } else {
-        response.error = curl_easy_strerror(res);
-    }
-    curl_easy_cleanup(curl);
-    return response;
+    return fetch(url).get();
 }
 
 std::vector<unsigned char> HttpClient::getBytes(const std::string& url) {
-    std::vector<unsigned char> data;
-    CURL* curl = curl_easy_init();
-    if (!curl) return data;
+    auto response = get(url);
+    if (!response.error.empty()) return {};
+    return std::vector<unsigned char>(response.body.begin(), response.body.end());
+}
 
-    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeBytesCallback);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &data);
-    curl_easy_setopt(curl, CURLOPT_USERAGENT, userAgent_.c_str());
-    curl_easy_setopt(curl, CURLOPT_TIMEOUT, timeout_);
-    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
-    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 1L);
+void HttpClient::getAsync(const std::string& url, std::function<void(Response)> callback,
+                          const std::map<std::string, std::string>& headers) {
+    Request request = makeRequest(url);
+    request.headers = headers;
+    getAsync(std::move(request), std::move(callback));
+}
 
-    CURLcode res = curl_easy_perform(curl);
-    if (res != CURLE_OK) {
-        data.clear();
-    }
-    curl_easy_cleanup(curl);
-    return data;
+void HttpClient::getAsync(Request request, std::function<void(Response)> callback) {
+    HttpEngine::getInstance().submit(std::move(request), [callback](Response response) {
+        HttpEngine::getInstance().post([callback, response = std::move(response)]() mutable {
+            callback(std::move(response));
+        });
+    });
+}
+
+bool HttpClient::getCached(const std::string& url, Response& response) {
+    std::string body;
+    if (!DiskCache::getInstance().get("http:" + url, body)) return false;
+    response = Response{200, std::move(body), {}, true, ""};
+    return true;
 }
 
-void HttpClient::getAsync(const std::string& url, std::function<void(Response)> callback) {
-    std::thread([this, url, callback]() { callback(get(url)); }).detach();
+void HttpClient::storeCached(const std::string& url, const Response& response) {
+    DiskCache::getInstance().put("http:" + url, response.body);
 }
 
 void HttpClient::setUserAgent(const std::string& ua) { userAgent_ = ua; }
@@ -0,0 +1,267 @@
+#include "utils/HttpEngine.hpp"
+#include <algorithm>
+
+namespace InfoDash {
+
+struct HttpEngine::Transfer {
+    HttpClient::Request request;
+    HttpClient::Response response{0, "", {}, false, ""};
+    Completion done;
+    CURL* easy = nullptr;
+    curl_slist* headerList = nullptr;
+
+    ~Transfer() { curl_slist_free_all(headerList); }
+};
+
+static size_t workerCount() {
+    size_t hw = std::thread::hardware_concurrency();
+    return std::clamp<size_t>(hw, 4, 8);
+}
+
+HttpEngine& HttpEngine::getInstance() {
+    static HttpEngine instance;
+    return instance;
+}
+
+HttpEngine::HttpEngine()
+    : multi_(nullptr), share_(nullptr), running_(true), workers_(workerCount()) {
+    curl_global_init(CURL_GLOBAL_ALL);
+    multi_ = curl_multi_init();
+
+    // Every easy handle is driven from the I/O thread, so the share needs no
+    // lock callbacks.
+    share_ = curl_share_init();
+    curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+    ioThread_ = std::thread([this]() { run(); });
+}
+
+HttpEngine::~HttpEngine() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    curl_multi_wakeup(multi_);
+    if (ioThread_.joinable()) ioThread_.join();
+    abortAll();
+    workers_.shutdown();
+    for (CURL* easy : idleHandles_) curl_easy_cleanup(easy);
+    idleHandles_.clear();
+    curl_multi_cleanup(multi_);
+    curl_share_cleanup(share_);
+    curl_global_cleanup();
+}
+
+size_t HttpEngine::writeCallback(void* contents, size_t size, size_t nmemb, void* userp) {
+    auto* t = static_cast<Transfer*>(userp);
+    t->response.body.append(static_cast<char*>(contents), size * nmemb);
+    if (t->request.onData) t->request.onData(static_cast<char*>(contents), size * nmemb);
+    // A short count makes curl abort the transfer right away.
+    if (t->request.cancelled && t->request.cancelled->load()) return 0;
+    return size * nmemb;
+}
+
+size_t HttpEngine::headerCallback(char* buffer, size_t size, size_t nitems, void* userdata) {
+    auto* headers = static_cast<std::map<std::string, std::string>*>(userdata);
+    std::string header(buffer, size * nitems);
+    size_t pos = header.find(':');
+    if (pos != std::string::npos) {
+        std::string key = header.substr(0, pos);
+        std::string val = header.substr(pos + 1);
+        val.erase(0, val.find_first_not_of(" \t"));
+        val.erase(val.find_last_not_of(" \t\r\n") + 1);
+        (*headers)[key] = val;
+    }
+    return size * nitems;
+}
+
+int HttpEngine::progressCallback(void* clientp, curl_off_t, curl_off_t, curl_off_t, curl_off_t) {
+    auto* t = static_cast<Transfer*>(clientp);
+    return t->request.cancelled && t->request.cancelled->load() ? 1 : 0;
+}
+
+void HttpEngine::submit(HttpClient::Request request, Completion done) {
+    auto transfer = std::make_unique<Transfer>();
+    transfer->request = std::move(request);
+    transfer->done = std::move(done);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (running_) {
+            pending_.push_back(std::move(transfer));
+        }
+    }
+    if (transfer) {
+        transfer->response.error = "HTTP engine stopped";
+        transfer->done(std::move(transfer->response));
+        return;
+    }
+    curl_multi_wakeup(multi_);
+}
+
+void HttpEngine::post(std::function<void()> task) {
+    workers_.post(std::move(task));
+}
+
+HttpEngine::Stats HttpEngine::stats() const {
+    return {requests_.load(), reusedConnections_.load(),
+            newConnections_.load(), pooledHandles_.load()};
+}
+
+// Idle easy handles keep their buffers and are re-attached to the share on
+// reuse; curl_easy_reset() clears per-request options only.
+CURL* HttpEngine::acquireHandle() {
+    CURL* easy = nullptr;
+    if (!idleHandles_.empty()) {
+        easy = idleHandles_.back();
+        idleHandles_.pop_back();
+        curl_easy_reset(easy);
+        ++pooledHandles_;
+    } else {
+        easy = curl_easy_init();
+        if (!easy) return nullptr;
+    }
+    curl_easy_setopt(easy, CURLOPT_SHARE, share_);
+    return easy;
+}
+
+void HttpEngine::releaseHandle(CURL* easy) {
+    if (idleHandles_.size() < kMaxInFlight) {
+        idleHandles_.push_back(easy);
+    } else {
+        curl_easy_cleanup(easy);
+    }
+}
+
+// Move queued transfers into the multi handle until the in-flight cap is hit.
+// Called only from the I/O thread.
+void HttpEngine::startPending() {
+    for (;;) {
+        std::unique_ptr<Transfer> t;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (pending_.empty() || inFlight_.size() >= kMaxInFlight) return;
+            t = std::move(pending_.front());
+            pending_.pop_front();
+        }
+
+        if (t->request.cancelled && t->request.cancelled->load()) {
+            t->response.error = "Cancelled";
+            t->done(std::move(t->response));
+            continue;
+        }
+
+        CURL* curl = acquireHandle();
+        if (!curl) {
+            t->response.error = "CURL init failed";
+            t->done(std::move(t->response));
+            continue;
+        }
+
+        curl_easy_setopt(curl, CURLOPT_URL, t->request.url.c_str());
+        curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeCallback);
+        curl_easy_setopt(curl, CURLOPT_WRITEDATA, t.get());
+        curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, headerCallback);
+        curl_easy_setopt(curl, CURLOPT_HEADERDATA, &t->response.headers);
+        curl_easy_setopt(curl, CURLOPT_USERAGENT, t->request.userAgent.c_str());
+        curl_easy_setopt(curl, CURLOPT_TIMEOUT, t->request.timeoutSeconds);
+        curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+        curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 1L);
+        curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, "gzip, deflate");
+        curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+        for (const auto& [name, value] : t->request.headers) {
+            std::string line = name + ": " + value;
+            t->headerList = curl_slist_append(t->headerList, line.c_str());
+        }
+        if (t->headerList) curl_easy_setopt(curl, CURLOPT_HTTPHEADER, t->headerList);
+        if (t->request.cancelled) {
+            curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, progressCallback);
+            curl_easy_setopt(curl, CURLOPT_XFERINFODATA, t.get());
+            curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+        }
+
+        t->easy = curl;
+        curl_easy_setopt(curl, CURLOPT_PRIVATE, t.get());
+        curl_multi_add_handle(multi_, curl);
+        inFlight_.insert(t.release());  // owned by inFlight_ until finish()
+    }
+}
+
+void HttpEngine::finish(CURL* easy, CURLcode result) {
+    Transfer* raw = nullptr;
+    curl_easy_getinfo(easy, CURLINFO_PRIVATE, &raw);
+    std::unique_ptr<Transfer> t(raw);
+
+    ++requests_;
+    long connects = 0;
+    if (curl_easy_getinfo(easy, CURLINFO_NUM_CONNECTS, &connects) == CURLE_OK) {
+        if (connects == 0 && result == CURLE_OK) ++reusedConnections_;
+        newConnections_ += static_cast<uint64_t>(connects);
+    }
+
+    // The status is kept for aborted transfers too; their partial body may
+    // still be useful to whoever cancelled them.
+    long httpCode = 0;
+    curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &httpCode);
+    t->response.statusCode = static_cast<int>(httpCode);
+    if (result == CURLE_OK) {
+        t->response.success = (httpCode >= 200 && httpCode < 300);
+    } else {
+        t->response.error = curl_easy_strerror(result);
+    }
+
+    curl_multi_remove_handle(multi_, easy);
+    releaseHandle(easy);
+    inFlight_.erase(raw);
+
+    t->done(std::move(t->response));
+}
+
+void HttpEngine::run() {
+    while (running_) {
+        startPending();
+
+        int stillRunning = 0;
+        curl_multi_perform(multi_, &stillRunning);
+
+        int msgsLeft = 0;
+        bool finished = false;
+        while (CURLMsg* msg = curl_multi_info_read(multi_, &msgsLeft)) {
+            if (msg->msg == CURLMSG_DONE) {
+                finish(msg->easy_handle, msg->data.result);
+                finished = true;
+            }
+        }
+        // Completions free in-flight slots; refill them before sleeping.
+        if (finished) continue;
+
+        // Sleeps until socket activity, a timeout, or curl_multi_wakeup()
+        // from submit()/shutdown.
+        curl_multi_poll(multi_, nullptr, 0, 1000, nullptr);
+    }
+}
+
+// Fail everything still queued or in flight so blocked callers wake up.
+// Runs after the I/O thread has exited.
+void HttpEngine::abortAll() {
+    std::deque<std::unique_ptr<Transfer>> pending;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending.swap(pending_);
+    }
+    for (auto& t : pending) {
+        t->response.error = "HTTP engine stopped";
+        t->done(std::move(t->response));
+    }
+
+    for (Transfer* raw : inFlight_) {
+        std::unique_ptr<Transfer> t(raw);
+        curl_multi_remove_handle(multi_, t->easy);
+        curl_easy_cleanup(t->easy);
+        t->response.error = "HTTP engine stopped";
+        t->done(std::move(t->response));
+    }
+    inFlight_.clear();
+}
+
+}
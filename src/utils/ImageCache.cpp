@@ -0,0 +1,71 @@
+#include "utils/ImageCache.hpp"
+
+namespace InfoDash {
+
+ImageCache& ImageCache::getInstance() {
+    static ImageCache instance;
+    return instance;
+}
+
+ImageCache::~ImageCache() {
+    clear();
+}
+
+GdkTexture* ImageCache::lookup(const std::string& key) {
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+        ++misses_;
+        return nullptr;
+    }
+    ++hits_;
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return it->second->texture;
+}
+
+void ImageCache::insert(const std::string& key, GdkTexture* texture) {
+    if (!texture) return;
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        bytes_ -= it->second->bytes;
+        g_object_unref(it->second->texture);
+        lru_.erase(it->second);
+        index_.erase(it);
+    }
+    // Textures are held as 4 bytes a pixel, whatever the source format.
+    size_t bytes = size_t(gdk_texture_get_width(texture)) * gdk_texture_get_height(texture) * 4;
+    lru_.push_front({key, texture, bytes});
+    index_[key] = lru_.begin();
+    bytes_ += bytes;
+    evict();
+}
+
+void ImageCache::setBudget(size_t bytes) {
+    budget_ = bytes;
+    evict();
+}
+
+// The newest entry always stays, so one texture larger than the whole
+// budget can still be shown.
+void ImageCache::evict() {
+    while (bytes_ > budget_ && lru_.size() > 1) {
+        Entry& victim = lru_.back();
+        bytes_ -= victim.bytes;
+        g_object_unref(victim.texture);
+        index_.erase(victim.key);
+        lru_.pop_back();
+        ++evictions_;
+    }
+}
+
+ImageCache::Stats ImageCache::stats() const {
+    return {hits_, misses_, evictions_, bytes_, lru_.size()};
+}
+
+void ImageCache::clear() {
+    for (Entry& e : lru_) g_object_unref(e.texture);
+    lru_.clear();
+    index_.clear();
+    bytes_ = 0;
+}
+
+}
@@ -0,0 +1,94 @@
+#include "utils/ImageDecoder.hpp"
+#include "utils/DiskCache.hpp"
+#include <utility>
+
+namespace InfoDash {
+
+ImageDecoder& ImageDecoder::getInstance() {
+    static ImageDecoder instance;
+    return instance;
+}
+
+ImageDecoder::ImageDecoder() {
+    for (size_t i = 0; i < kThreads; ++i) {
+        workers_.emplace_back([this]() { workerLoop(); });
+    }
+}
+
+// Jobs still queued are dropped without their callbacks, which may refer
+// to a main loop that has already gone.
+ImageDecoder::~ImageDecoder() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+        jobs_.clear();
+    }
+    cv_.notify_all();
+    for (auto& t : workers_) {
+        if (t.joinable()) t.join();
+    }
+}
+
+void ImageDecoder::decode(std::string data, int width, int height, std::string storeKey, Done done) {
+    Job dropped;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_) return;
+        if (jobs_.size() >= kMaxQueued) {
+            dropped = std::move(jobs_.front());
+            jobs_.pop_front();
+        }
+        jobs_.push_back({std::move(data), width, height, std::move(storeKey), std::move(done)});
+    }
+    cv_.notify_one();
+    if (dropped.done) dropped.done(nullptr, true);
+}
+
+GdkPixbuf* ImageDecoder::decodeAtSize(const std::string& data, int width, int height) {
+    GInputStream* stream = g_memory_input_stream_new_from_data(data.data(), data.size(), nullptr);
+    GdkPixbuf* pixbuf = gdk_pixbuf_new_from_stream_at_scale(stream, width, height, TRUE, nullptr, nullptr);
+    g_object_unref(stream);
+    return pixbuf;
+}
+
+std::string ImageDecoder::encode(GdkPixbuf* pixbuf) {
+    gchar* buffer = nullptr;
+    gsize size = 0;
+    gboolean ok = gdk_pixbuf_get_has_alpha(pixbuf)
+        ? gdk_pixbuf_save_to_buffer(pixbuf, &buffer, &size, "png", nullptr, nullptr)
+        : gdk_pixbuf_save_to_buffer(pixbuf, &buffer, &size, "jpeg", nullptr, "quality", "85", nullptr);
+    std::string encoded = ok ? std::string(buffer, size) : std::string();
+    g_free(buffer);
+    return encoded;
+}
+
+void ImageDecoder::workerLoop() {
+    for (;;) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() { return stopping_ || !jobs_.empty(); });
+            if (stopping_) return;
+            job = std::move(jobs_.front());
+            jobs_.pop_front();
+        }
+        GdkPixbuf* pixbuf = decodeAtSize(job.data, job.width, job.height);
+        if (!pixbuf) {
+            job.done(nullptr, false);
+            continue;
+        }
+        if (!job.storeKey.empty()) {
+            std::string encoded = encode(pixbuf);
+            if (!encoded.empty()) DiskCache::thumbnails().put(job.storeKey, encoded);
+        }
+        // A memory texture: no GL context is involved, so this is safe off
+        // the main thread, and GSK uploads it once when first drawn.
+G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+        GdkTexture* texture = gdk_texture_new_for_pixbuf(pixbuf);
+G_GNUC_END_IGNORE_DEPRECATIONS
+        g_object_unref(pixbuf);
+        job.done(texture, false);
+    }
+}
+
+}
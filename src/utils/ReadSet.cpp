@@ -0,0 +1,157 @@
+#include "utils/ReadSet.hpp"
+#include <chrono>
+
+namespace InfoDash {
+
+static constexpr size_t kMinCapacity = 1024;
+
+uint64_t ReadSet::hash(std::string_view id) {
+    uint64_t h = 1469598103934665603ull;
+    for (unsigned char c : id) {
+        h ^= c;
+        h *= 1099511628211ull;
+    }
+    // FNV-1a spreads poorly into the low bits used for slots; finish with a
+    // murmur-style mix. 0 is the empty-slot marker.
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    return h ? h : 1;
+}
+
+ReadSet::Day ReadSet::today() {
+    auto days = std::chrono::duration_cast<std::chrono::hours>(
+        std::chrono::system_clock::now().time_since_epoch()).count() / 24;
+    return static_cast<Day>(days);
+}
+
+// Index of h's slot, or of the empty slot where it would go.
+size_t ReadSet::slot(uint64_t h) const {
+    size_t mask = keys_.size() - 1;
+    size_t i = static_cast<size_t>(h) & mask;
+    while (keys_[i] != 0 && keys_[i] != h) i = (i + 1) & mask;
+    return i;
+}
+
+bool ReadSet::contains(uint64_t h) const {
+    if (size_ == 0) return false;
+    return keys_[slot(h)] == h;
+}
+
+bool ReadSet::insert(uint64_t h, Day day) {
+    if ((size_ + 1) * 10 > keys_.size() * 7) grow();
+    size_t i = slot(h);
+    days_[i] = day;
+    if (keys_[i] == h) return false;
+    keys_[i] = h;
+    ++size_;
+    return true;
+}
+
+bool ReadSet::touch(uint64_t h, Day day) {
+    if (size_ == 0) return false;
+    size_t i = slot(h);
+    if (keys_[i] != h || days_[i] == day) return false;
+    days_[i] = day;
+    return true;
+}
+
+// Linear probing with backward-shift deletion: later entries of the same
+// probe run move up into the hole, so no tombstones pile up.
+bool ReadSet::erase(uint64_t h) {
+    if (size_ == 0) return false;
+    size_t mask = keys_.size() - 1;
+    size_t hole = slot(h);
+    if (keys_[hole] != h) return false;
+    for (size_t i = (hole + 1) & mask; keys_[i] != 0; i = (i + 1) & mask) {
+        size_t home = static_cast<size_t>(keys_[i]) & mask;
+        // Move i into the hole unless its home lies cyclically in (hole, i].
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            keys_[hole] = keys_[i];
+            days_[hole] = days_[i];
+            hole = i;
+        }
+    }
+    keys_[hole] = 0;
+    --size_;
+    return true;
+}
+
+size_t ReadSet::expire(Day cutoff) {
+    std::vector<uint64_t> keys;
+    std::vector<Day> days;
+    keys.swap(keys_);
+    days.swap(days_);
+    size_t before = size_;
+    size_ = 0;
+    keys_.assign(keys.size(), 0);
+    days_.assign(keys.size(), 0);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        if (keys[i] != 0 && days[i] >= cutoff) insert(keys[i], days[i]);
+    }
+    return before - size_;
+}
+
+void ReadSet::grow() {
+    std::vector<uint64_t> keys;
+    std::vector<Day> days;
+    keys.swap(keys_);
+    days.swap(days_);
+    size_t capacity = keys.empty() ? kMinCapacity : keys.size() * 2;
+    keys_.assign(capacity, 0);
+    days_.assign(capacity, 0);
+    size_ = 0;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        if (keys[i] != 0) {
+            size_t j = slot(keys[i]);
+            keys_[j] = keys[i];
+            days_[j] = days[i];
+            ++size_;
+        }
+    }
+}
+
+void ReadSet::clear() {
+    keys_.clear();
+    days_.clear();
+    size_ = 0;
+}
+
+size_t ReadSet::memoryUsage() const {
+    return keys_.capacity() * sizeof(uint64_t) + days_.capacity() * sizeof(Day);
+}
+
+std::string ReadSet::encode() const {
+    static const char digits[] = "0123456789abcdef";
+    std::string out;
+    out.reserve(size_ * 20);
+    for (size_t i = 0; i < keys_.size(); ++i) {
+        if (keys_[i] == 0) continue;
+        for (int shift = 60; shift >= 0; shift -= 4) out.push_back(digits[(keys_[i] >> shift) & 0xf]);
+        for (int shift = 12; shift >= 0; shift -= 4) out.push_back(digits[(days_[i] >> shift) & 0xf]);
+    }
+    return out;
+}
+
+static bool parseHex(std::string_view text, uint64_t& value) {
+    value = 0;
+    for (char c : text) {
+        int d;
+        if (c >= '0' && c <= '9') d = c - '0';
+        else if (c >= 'a' && c <= 'f') d = c - 'a' + 10;
+        else return false;
+        value = (value << 4) | static_cast<uint64_t>(d);
+    }
+    return true;
+}
+
+void ReadSet::decode(std::string_view text) {
+    for (size_t pos = 0; pos + 20 <= text.size(); pos += 20) {
+        uint64_t h, day;
+        if (parseHex(text.substr(pos, 16), h) && parseHex(text.substr(pos + 16, 4), day) && h != 0) {
+            insert(h, static_cast<Day>(day));
+        }
+    }
+}
+
+}
@@ -828,6 +828,31 @@ std::string ThemeManager::generateCSS() const {
             outline: none;
         }
         
+        /* Article views: grid cells pad each card so neighbours end up
+           16px apart, matching the list's outer margin */
+        gridview.article-view {
+            background-color: transparent;
+            padding: 8px;
+        }
+        
+        gridview.article-view > child {
+            background-color: transparent;
+            padding: 8px;
+        }
+        
+        gridview.article-view > child:focus {
+            outline: none;
+        }
+        
+        listview.article-view {
+            margin: 16px;
+        }
+        
+        /* Article images; the box shows while the image is on its way */
+        picture.article-image.loading {
+            background-color: )" << c.inputBg << R"(;
+        }
+        
         /* Dialog styles */
         .title-2 {
             font-size: 20px;
@@ -0,0 +1,43 @@
+#include "utils/UiDispatcher.hpp"
+#include <glib.h>
+#include <memory>
+#include <utility>
+
+namespace InfoDash {
+
+UiDispatcher& UiDispatcher::getInstance() {
+    static UiDispatcher instance;
+    return instance;
+}
+
+void UiDispatcher::post(std::function<void()> task) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push_back(std::move(task));
+    if (scheduled_) return;
+    scheduled_ = true;
+    g_timeout_add(kFrameMs, dispatch, this);
+}
+
+void UiDispatcher::postAfter(unsigned delayMs, std::function<void()> task) {
+    auto* held = new std::function<void()>(std::move(task));
+    g_timeout_add(delayMs, +[](gpointer data) -> gboolean {
+        std::unique_ptr<std::function<void()>> task(static_cast<std::function<void()>*>(data));
+        getInstance().post(std::move(*task));
+        return G_SOURCE_REMOVE;
+    }, held);
+}
+
+int UiDispatcher::dispatch(void* data) {
+    auto* self = static_cast<UiDispatcher*>(data);
+    std::vector<std::function<void()>> tasks;
+    {
+        std::lock_guard<std::mutex> lock(self->mutex_);
+        tasks.swap(self->tasks_);
+        self->scheduled_ = false;
+    }
+    // Tasks posted while these run go to the next frame.
+    for (auto& task : tasks) task();
+    return G_SOURCE_REMOVE;
+}
+
+}
@@ -0,0 +1,246 @@
+#include "utils/Utf8.hpp"
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define INFODASH_UTF8_X86 1
+#endif
+
+namespace InfoDash {
+
+// Length of the valid sequence starting at p (1-4), or 0 if the bytes at p
+// do not start a valid sequence.
+static size_t sequenceLength(const unsigned char* p, const unsigned char* end) {
+    unsigned char c = p[0];
+    if (c < 0x80) return 1;
+
+    size_t len;
+    unsigned char lo = 0x80, hi = 0xBF;  // allowed range of the second byte
+    if (c >= 0xC2 && c <= 0xDF) {
+        len = 2;
+    } else if (c >= 0xE0 && c <= 0xEF) {
+        len = 3;
+        if (c == 0xE0) lo = 0xA0;       // overlong
+        else if (c == 0xED) hi = 0x9F;  // surrogates
+    } else if (c >= 0xF0 && c <= 0xF4) {
+        len = 4;
+        if (c == 0xF0) lo = 0x90;       // overlong
+        else if (c == 0xF4) hi = 0x8F;  // past U+10FFFF
+    } else {
+        return 0;
+    }
+
+    if (static_cast<size_t>(end - p) < len) return 0;
+    if (p[1] < lo || p[1] > hi) return 0;
+    for (size_t i = 2; i < len; ++i) {
+        if ((p[i] & 0xC0) != 0x80) return 0;
+    }
+    return len;
+}
+
+static bool validScalar(const unsigned char* p, const unsigned char* end) {
+    while (p < end) {
+        size_t len = sequenceLength(p, end);
+        if (len == 0) return false;
+        p += len;
+    }
+    return true;
+}
+
+#ifdef INFODASH_UTF8_X86
+
+// SSE2 has no byte shuffle, so this kernel only skips ASCII 16 bytes at a
+// time and validates multibyte sequences with the scalar decoder.
+static bool validSse2(const unsigned char* p, const unsigned char* end) {
+    while (p < end) {
+        if (end - p >= 16) {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            if (_mm_movemask_epi8(block) == 0) {
+                p += 16;
+                continue;
+            }
+        }
+        size_t len = sequenceLength(p, end);
+        if (len == 0) return false;
+        p += len;
+    }
+    return true;
+}
+
+// AVX2 kernel: the lookup-table validator of Keiser and Lemire ("Validating
+// UTF-8 In Less Than One Instruction Per Byte", 2021). Each byte is checked
+// against the one to three bytes before it with three nibble lookups, so
+// multibyte text is validated 32 bytes at a time as well.
+namespace {
+
+constexpr uint8_t kTooShort = 1 << 0;
+constexpr uint8_t kTooLong = 1 << 1;
+constexpr uint8_t kOverlong3 = 1 << 2;
+constexpr uint8_t kTooLarge = 1 << 3;
+constexpr uint8_t kSurrogate = 1 << 4;
+constexpr uint8_t kOverlong2 = 1 << 5;
+constexpr uint8_t kTooLarge1000 = 1 << 6;
+constexpr uint8_t kOverlong4 = 1 << 6;
+constexpr uint8_t kTwoConts = 1 << 7;
+constexpr uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+}
+
+__attribute__((target("avx2")))
+static inline __m256i lookup16(__m256i nibbles, const uint8_t (&table)[16]) {
+    __m128i t = _mm_loadu_si128(reinterpret_cast<const __m128i*>(table));
+    return _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(t), nibbles);
+}
+
+// The 32 bytes ending N bytes before the end of `input`, spanning `prev`.
+template <int N>
+__attribute__((target("avx2")))
+static inline __m256i prevBytes(__m256i input, __m256i prev) {
+    return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev, input, 0x21), 16 - N);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i checkBlock(__m256i input, __m256i prevInput) {
+    static const uint8_t byte1High[16] = {
+        kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+        kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+        kTooShort | kOverlong2,
+        kTooShort,
+        kTooShort | kOverlong3 | kSurrogate,
+        kTooShort | kTooLarge | kTooLarge1000 | kOverlong4,
+    };
+    static const uint8_t byte1Low[16] = {
+        kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+        kCarry | kOverlong2,
+        kCarry,
+        kCarry,
+        kCarry | kTooLarge,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+        kCarry | kTooLarge | kTooLarge1000,
+        kCarry | kTooLarge | kTooLarge1000,
+    };
+    static const uint8_t byte2High[16] = {
+        kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort,
+        kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+        kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+        kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+        kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+        kTooShort, kTooShort, kTooShort, kTooShort,
+    };
+
+    const __m256i lowNibble = _mm256_set1_epi8(0x0F);
+    __m256i prev1 = prevBytes<1>(input, prevInput);
+    __m256i b1High = lookup16(_mm256_and_si256(_mm256_srli_epi16(prev1, 4), lowNibble), byte1High);
+    __m256i b1Low = lookup16(_mm256_and_si256(prev1, lowNibble), byte1Low);
+    __m256i b2High = lookup16(_mm256_and_si256(_mm256_srli_epi16(input, 4), lowNibble), byte2High);
+    __m256i special = _mm256_and_si256(_mm256_and_si256(b1High, b1Low), b2High);
+
+    // Third and fourth bytes of 3- and 4-byte sequences must be continuations.
+    __m256i prev2 = prevBytes<2>(input, prevInput);
+    __m256i prev3 = prevBytes<3>(input, prevInput);
+    __m256i third = _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+    __m256i fourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+    __m256i must23 = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8(static_cast<char>(0x80)));
+    return _mm256_xor_si256(must23, special);
+}
+
+// Non-zero if the block ends inside a multibyte sequence.
+__attribute__((target("avx2")))
+static inline __m256i incompleteTail(__m256i input) {
+    const __m256i maxValue = _mm256_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+    return _mm256_subs_epu8(input, maxValue);
+}
+
+struct Avx2State {
+    __m256i error;
+    __m256i prevInput;
+    __m256i prevIncomplete;
+};
+
+__attribute__((target("avx2")))
+static inline void checkStep(Avx2State& st, __m256i input) {
+    if (_mm256_movemask_epi8(input) == 0) {
+        // Pure ASCII: only an unfinished sequence from the last block can fail.
+        st.error = _mm256_or_si256(st.error, st.prevIncomplete);
+    } else {
+        st.error = _mm256_or_si256(st.error, checkBlock(input, st.prevInput));
+        st.prevIncomplete = incompleteTail(input);
+    }
+    st.prevInput = input;
+}
+
+__attribute__((target("avx2")))
+static bool validAvx2(const unsigned char* p, const unsigned char* end) {
+    Avx2State st;
+    st.error = _mm256_setzero_si256();
+    st.prevInput = _mm256_setzero_si256();
+    st.prevIncomplete = _mm256_setzero_si256();
+
+    while (end - p >= 32) {
+        checkStep(st, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+        p += 32;
+    }
+    if (p < end) {
+        alignas(32) unsigned char tail[32] = {};
+        memcpy(tail, p, end - p);
+        checkStep(st, _mm256_load_si256(reinterpret_cast<const __m256i*>(tail)));
+    }
+    st.error = _mm256_or_si256(st.error, st.prevIncomplete);
+    return _mm256_testz_si256(st.error, st.error) != 0;
+}
+
+#endif
+
+using Validator = bool (*)(const unsigned char*, const unsigned char*);
+
+static Validator pickValidator() {
+#ifdef INFODASH_UTF8_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return validAvx2;
+    if (__builtin_cpu_supports("sse2")) return validSse2;
+#endif
+    return validScalar;
+}
+
+bool Utf8::isValid(std::string_view text) {
+    static const Validator validate = pickValidator();
+    auto* p = reinterpret_cast<const unsigned char*>(text.data());
+    return validate(p, p + text.size());
+}
+
+std::string Utf8::sanitize(std::string text) {
+    if (isValid(text)) return text;
+
+    // Slow path: copy valid runs in bulk and drop each offending byte.
+    std::string result;
+    result.reserve(text.size());
+    auto* begin = reinterpret_cast<const unsigned char*>(text.data());
+    auto* end = begin + text.size();
+    const unsigned char* run = begin;
+    const unsigned char* p = begin;
+    while (p < end) {
+        size_t len = sequenceLength(p, end);
+        if (len) {
+            p += len;
+            continue;
+        }
+        result.append(reinterpret_cast<const char*>(run), p - run);
+        run = ++p;
+    }
+    result.append(reinterpret_cast<const char*>(run), p - run);
+    return result;
+}
+
+}
@@ -0,0 +1,87 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <malloc.h>
+#include <new>
+#include <string>
+#include <vector>
+#include "services/ArticleStore.hpp"
+
+// Memory benchmark for ArticleStore against the std::vector<RSSItem> the
+// article panel used to keep (plus the per-widget RSSItem copy it attached
+// to every card). Counts live heap bytes and allocations through the global
+// operator new, and reports them per article.
+
+static size_t liveBytes = 0;
+static size_t allocations = 0;
+
+void* operator new(size_t size) {
+    void* p = std::malloc(size);
+    if (!p) throw std::bad_alloc();
+    liveBytes += malloc_usable_size(p);
+    ++allocations;
+    return p;
+}
+
+__attribute__((noinline)) void operator delete(void* p) noexcept {
+    if (!p) return;
+    liveBytes -= malloc_usable_size(p);
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept { operator delete(p); }
+
+static const size_t kArticles = 20000;
+
+static std::vector<InfoDash::RSSItem> makeItems() {
+    std::vector<InfoDash::RSSItem> items;
+    items.reserve(kArticles);
+    for (size_t i = 0; i < kArticles; ++i) {
+        InfoDash::RSSItem item;
+        std::string n = std::to_string(i);
+        item.title = "Researchers report progress on item " + n + " after a long week of work";
+        item.link = "https://news.example.com/2026/10/16/some-long-article-slug-for-item-" + n;
+        item.description = std::string(180, 'x') + " summary " + n + "...";
+        item.pubDate = "Fri, 16 Oct 2026 07:05:01 +0000";
+        item.pubTime = 1792134301 - static_cast<int64_t>(i) * 60;
+        if (i % 5 < 3) item.imageUrl = "https://img.example.com/thumbs/" + n + ".jpg";
+        item.source = "Example Feed " + std::to_string(i % 200);
+        item.author = "Staff Writer " + std::to_string(i % 500);
+        items.push_back(std::move(item));
+    }
+    return items;
+}
+
+int main() {
+    auto items = makeItems();
+
+    size_t before = liveBytes, allocsBefore = allocations;
+    auto start = std::chrono::steady_clock::now();
+    std::vector<InfoDash::RSSItem> copies = items;
+    std::vector<InfoDash::RSSItem*> widgetCopies;
+    widgetCopies.reserve(items.size());
+    for (const auto& item : items) widgetCopies.push_back(new InfoDash::RSSItem(item));
+    std::chrono::duration<double> legacyTime = std::chrono::steady_clock::now() - start;
+    size_t legacyBytes = liveBytes - before, legacyAllocs = allocations - allocsBefore;
+
+    before = liveBytes;
+    allocsBefore = allocations;
+    start = std::chrono::steady_clock::now();
+    InfoDash::ArticleStore store;
+    for (const auto& item : items) store.add(item);
+    std::chrono::duration<double> storeTime = std::chrono::steady_clock::now() - start;
+    size_t storeBytes = liveBytes - before, storeAllocs = allocations - allocsBefore;
+
+    std::cout << kArticles << " articles\n";
+    std::cout << "vector<RSSItem> + widget copies: " << legacyBytes / kArticles << " bytes/article, "
+              << static_cast<double>(legacyAllocs) / kArticles << " allocations/article, "
+              << legacyTime.count() * 1000 << " ms\n";
+    std::cout << "ArticleStore:                    " << storeBytes / kArticles << " bytes/article, "
+              << static_cast<double>(storeAllocs) / kArticles << " allocations/article, "
+              << storeTime.count() * 1000 << " ms\n";
+    std::cout << "ArticleStore::memoryUsage():     " << store.memoryUsage() / kArticles
+              << " bytes/article\n";
+
+    for (auto* item : widgetCopies) delete item;
+    return store.size() == copies.size() ? 0 : 1;
+}
@@ -0,0 +1,128 @@
+#include <iostream>
+#include <chrono>
+#include <regex>
+#include <string>
+#include <vector>
+#include "utils/HtmlParser.hpp"
+
+// Benchmark for HtmlParser::htmlToText against the regex-based description
+// cleanup it replaced. Prints items/second for each and how many outputs agree.
+
+static std::string legacyExtractImage(const std::string& html) {
+    std::regex imgRegex(R"(<img[^>]+src\s*=\s*[\"']([^\"']+)[\"'])");
+    std::smatch match;
+    if (std::regex_search(html, match, imgRegex)) return match[1].str();
+    return "";
+}
+
+static std::string legacySummarize(std::string desc) {
+    std::regex tagRegex("<[^>]*>");
+    desc = std::regex_replace(desc, tagRegex, "");
+    size_t pos;
+    while ((pos = desc.find("&amp;")) != std::string::npos) desc.replace(pos, 5, "&");
+    while ((pos = desc.find("&lt;")) != std::string::npos) desc.replace(pos, 4, "<");
+    while ((pos = desc.find("&gt;")) != std::string::npos) desc.replace(pos, 4, ">");
+    while ((pos = desc.find("&quot;")) != std::string::npos) desc.replace(pos, 6, "\"");
+    while ((pos = desc.find("&nbsp;")) != std::string::npos) desc.replace(pos, 6, " ");
+    while ((pos = desc.find("&#39;")) != std::string::npos) desc.replace(pos, 5, "'");
+    size_t start = desc.find_first_not_of(" \t\n\r");
+    size_t end = desc.find_last_not_of(" \t\n\r");
+    if (start != std::string::npos) desc = desc.substr(start, end - start + 1);
+    if (desc.length() > 200) desc = desc.substr(0, 200) + "...";
+    return desc;
+}
+
+static std::vector<std::string> makeCorpus() {
+    std::vector<std::string> corpus;
+    for (int i = 0; i < 1000; ++i) {
+        std::string html;
+        switch (i % 4) {
+        case 0:  // short plain summary
+            html = "  A short summary &amp; nothing else, item " + std::to_string(i) + ".  ";
+            break;
+        case 1:  // typical news blurb with markup and an image
+            html = "<p><img src=\"https://img.example.com/" + std::to_string(i) +
+                   ".jpg\" width=\"600\"/></p><p>Officials said on <b>Tuesday</b> that the "
+                   "&quot;plan&quot; would go ahead &amp; cost less than expected.</p>";
+            break;
+        case 2:  // long show notes
+            for (int j = 0; j < 60; ++j) {
+                html += "<li><a href=\"https://example.com/" + std::to_string(j) +
+                        "\">Link " + std::to_string(j) + "</a> &nbsp;notes &lt;here&gt;</li>\n";
+            }
+            break;
+        default:  // full article body with the image near the end
+            for (int j = 0; j < 40; ++j) {
+                html += "<p class=\"para\">Paragraph " + std::to_string(j) +
+                        " of the article text, with some &#39;quotes&#39; in it.</p>";
+            }
+            html += "<figure><img alt=\"x\" src='https://img.example.com/tail.png'></figure>";
+            break;
+        }
+        corpus.push_back(std::move(html));
+    }
+    return corpus;
+}
+
+// Ordinary feed text that once sent the image search into an endless loop:
+// a '<' with no '>' anywhere after it, alone or after the text limit.
+static std::vector<std::string> makeEdgeCases() {
+    std::string longText(240, 'a');
+    return {
+        "price 1 < 2 today",
+        longText + " x < y",
+        "<p>" + longText + "</p> and 3 < 4",
+        "<img src=\"https://img.example.com/a.jpg\"> then 5 < 6",
+    };
+}
+
+template <typename Fn>
+static double itemsPerSecond(const std::vector<std::string>& corpus, int rounds, Fn fn) {
+    size_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        for (const auto& html : corpus) sink += fn(html);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    if (sink == 0) std::cout << "";
+    return corpus.size() * rounds / elapsed.count();
+}
+
+int main() {
+    auto corpus = makeCorpus();
+
+    size_t agree = 0;
+    for (const auto& html : corpus) {
+        std::string image;
+        std::string text = InfoDash::HtmlParser::htmlToText(html, InfoDash::HtmlParser::kDescriptionLimit, &image);
+        if (text == legacySummarize(html) && image == legacyExtractImage(html)) ++agree;
+    }
+    std::cout << "Outputs agree on " << agree << "/" << corpus.size() << " items\n";
+
+    auto edges = makeEdgeCases();
+    size_t edgeAgree = 0;
+    for (const auto& html : edges) {
+        std::string image;
+        std::string text = InfoDash::HtmlParser::htmlToText(html, InfoDash::HtmlParser::kDescriptionLimit, &image);
+        std::string onlyImage = InfoDash::HtmlParser::extractImageFromHtml(html);
+        if (text == legacySummarize(html) && image == legacyExtractImage(html) &&
+            onlyImage == legacyExtractImage(html)) {
+            ++edgeAgree;
+        }
+    }
+    std::cout << "Edge cases agree on " << edgeAgree << "/" << edges.size() << "\n";
+
+    double legacy = itemsPerSecond(corpus, 5, [](const std::string& html) {
+        return legacySummarize(html).size() + legacyExtractImage(html).size();
+    });
+    double scanner = itemsPerSecond(corpus, 50, [](const std::string& html) {
+        std::string image;
+        return InfoDash::HtmlParser::htmlToText(html, InfoDash::HtmlParser::kDescriptionLimit, &image).size() +
+               image.size();
+    });
+
+    std::cout << "regex + find/replace: " << static_cast<long>(legacy) << " items/s\n";
+    std::cout << "single-pass scanner:  " << static_cast<long>(scanner) << " items/s\n";
+    std::cout << "speedup: " << scanner / legacy << "x\n";
+    return 0;
+}
@@ -11,7 +11,7 @@ int main() {
     std::string testUrl = "https://www.cnn.com";
     std::cout << "Fetching: " << testUrl << "\n";
 
-    svc.fetchFeed(testUrl, [prom](std::vector<InfoDash::RSSItem> items){
+    svc.fetchFeed(testUrl, [prom](std::vector<InfoDash::RSSItem> items, bool){
         prom->set_value(std::move(items));
     });
 
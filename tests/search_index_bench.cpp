@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "services/SearchIndex.hpp"
+
+// Build and query latency of SearchIndex over a synthetic 50k-article set.
+// Words are drawn from a Zipf-like distribution over a generated vocabulary,
+// so there are a few very common words and a long tail of rare ones, as in
+// real feeds. Descriptions carry some markup, as feed summaries do.
+
+static const size_t kArticles = 50000;
+static const size_t kVocabulary = 30000;
+static const int kRuns = 200;
+
+struct Article {
+    std::string title;
+    std::string description;
+    std::string author;
+};
+
+static std::vector<std::string> makeVocabulary(std::mt19937& rng) {
+    std::uniform_int_distribution<int> letter('a', 'z');
+    std::uniform_int_distribution<int> length(3, 10);
+    std::vector<std::string> words(kVocabulary);
+    for (auto& w : words) {
+        int n = length(rng);
+        for (int i = 0; i < n; ++i) w.push_back(static_cast<char>(letter(rng)));
+    }
+    return words;
+}
+
+static std::vector<Article> makeArticles(const std::vector<std::string>& words, std::mt19937& rng) {
+    // Zipf(1) ranks via inverse-CDF over harmonic weights.
+    std::vector<double> cdf(words.size());
+    double sum = 0;
+    for (size_t i = 0; i < words.size(); ++i) cdf[i] = (sum += 1.0 / static_cast<double>(i + 1));
+    std::uniform_real_distribution<double> u(0, sum);
+    auto pick = [&]() -> const std::string& {
+        return words[std::lower_bound(cdf.begin(), cdf.end(), u(rng)) - cdf.begin()];
+    };
+
+    std::vector<Article> articles(kArticles);
+    for (size_t i = 0; i < kArticles; ++i) {
+        Article& a = articles[i];
+        for (int w = 0; w < 10; ++w) a.title += (w ? " " : "") + pick();
+        a.description = "<p>";
+        for (int w = 0; w < 60; ++w) {
+            if (w == 20) a.description += " <a href=\"https://example.com/" + std::to_string(i) + "\">";
+            a.description += " " + pick();
+            if (w == 24) a.description += "</a> &amp;";
+        }
+        a.description += "</p>";
+        a.author = "Staff Writer " + std::to_string(i % 500);
+    }
+    return articles;
+}
+
+static void timeQuery(const InfoDash::SearchIndex& index, const std::string& query) {
+    std::vector<double> us;
+    size_t hits = 0;
+    for (int r = 0; r < kRuns; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        hits = index.search(query).size();
+        us.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+    }
+    std::sort(us.begin(), us.end());
+    std::cout << "  \"" << query << "\": " << hits << " hits, median " << us[us.size() / 2]
+              << " us, p99 " << us[us.size() * 99 / 100] << " us\n";
+}
+
+int main() {
+    std::mt19937 rng(42);
+    auto words = makeVocabulary(rng);
+    auto articles = makeArticles(words, rng);
+
+    auto start = std::chrono::steady_clock::now();
+    InfoDash::SearchIndex index;
+    for (size_t i = 0; i < articles.size(); ++i) {
+        index.add(static_cast<InfoDash::SearchIndex::DocId>(i), articles[i].title,
+                  articles[i].description, articles[i].author);
+    }
+    std::chrono::duration<double> build = std::chrono::steady_clock::now() - start;
+
+    std::cout << kArticles << " articles, " << index.termCount() << " terms\n";
+    std::cout << "build: " << build.count() * 1000 << " ms, "
+              << index.memoryUsage() / (1024 * 1024) << " MiB\n";
+
+    start = std::chrono::steady_clock::now();
+    index.prepare();
+    std::chrono::duration<double> prepare = std::chrono::steady_clock::now() - start;
+    std::cout << "prepare (word list sort): " << prepare.count() * 1000 << " ms\n";
+
+    std::cout << "query latency (" << kRuns << " runs):\n";
+    timeQuery(index, words[kVocabulary - 1]);              // rare word
+    timeQuery(index, words[50]);                           // mid-frequency word
+    timeQuery(index, words[0]);                            // most common word
+    timeQuery(index, words[200].substr(0, 3));             // typing: 3-letter prefix
+    timeQuery(index, words[10] + " " + words[300]);        // two words
+    timeQuery(index, words[5] + " " + words[1].substr(0, 2));
+    timeQuery(index, "writer 42");
+    return 0;
+}
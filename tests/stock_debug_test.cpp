@@ -1,6 +1,7 @@
 #include <iostream>
 #include <vector>
 #include "services/StockService.hpp"
+#include "utils/HttpEngine.hpp"
 #include <future>
 
 int main() {
@@ -14,5 +15,11 @@ int main() {
         auto d = f.get();
         std::cout << "Symbol: " << s << " -> name: " << d.name << ", price: " << d.price << ", change: " << d.change << "\n";
     }
+
+    auto stats = InfoDash::HttpEngine::getInstance().stats();
+    std::cout << "HTTP: " << stats.requests << " requests, "
+              << stats.reusedConnections << " reused connections, "
+              << stats.newConnections << " new connections, "
+              << stats.pooledHandles << " pooled handles\n";
     return 0;
 }